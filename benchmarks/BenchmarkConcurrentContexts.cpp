@@ -0,0 +1,164 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This program measures how the throughput of many small, independent systems in one process scales with the number
+ * of threads stepping them, as in batched screening.  Usage:
+ *
+ *     BenchmarkConcurrentContexts [--contexts 64] [--particles 100] [--steps 200] [--threads 1,2,4,8]
+ *                                 [--platform Reference]
+ *
+ * For each thread count, the Contexts are created, stepped and destroyed by the threads, each owning every
+ * numThreads-th Context and stepping its Contexts in turn.  The program reports the Context steps per second and the
+ * parallel efficiency relative to the first thread count.  MPI is initialized with MPI_THREAD_MULTIPLE, since PLUMED
+ * calls MPI from every thread.
+ */
+
+#include "PlumedForce.h"
+#include "openmm/Context.h"
+#include "openmm/Platform.h"
+#include "openmm/System.h"
+#include "openmm/VerletIntegrator.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mpi.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+extern "C" OPENMM_EXPORT void registerPlumedReferenceKernelFactories();
+
+static vector<int> parseList(const string& list) {
+    vector<int> values;
+    stringstream stream(list);
+    string item;
+    while (getline(stream, item, ','))
+        values.push_back(atoi(item.c_str()));
+    return values;
+}
+
+static void stepContexts(int first, int stride, int numContexts, int numParticles, int steps, const string& platformName, FILE* log) {
+    vector<unique_ptr<System> > systems;
+    vector<unique_ptr<VerletIntegrator> > integrators;
+    vector<unique_ptr<Context> > contexts;
+    stringstream script;
+    script << "rg: GYRATION ATOMS=1-" << numParticles << "\nRESTRAINT ARG=rg AT=1 KAPPA=10\n";
+    for (int i = first; i < numContexts; i += stride) {
+        systems.push_back(unique_ptr<System>(new System()));
+        vector<Vec3> positions(numParticles);
+        for (int j = 0; j < numParticles; j++) {
+            systems.back()->addParticle(1.0);
+            positions[j] = Vec3(j%5, (j/5)%5, j/25)*0.3*(1.0+0.01*i);
+        }
+        PlumedForce* force = new PlumedForce(script.str(), MPI_COMM_SELF, MPI_COMM_SELF);
+        force->setLogStream(log);
+        systems.back()->addForce(force);
+        integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.001)));
+        contexts.push_back(unique_ptr<Context>(new Context(*systems.back(), *integrators.back(), Platform::getPlatformByName(platformName))));
+        contexts.back()->setPositions(positions);
+    }
+    for (int step = 0; step < steps; step++)
+        for (auto& integrator : integrators)
+            integrator->step(1);
+}
+
+int main(int argc, char* argv[]) {
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
+    int numContexts = 64, numParticles = 100, steps = 200;
+    vector<int> threadCounts = {1, 2, 4, 8};
+    string platformName = "Reference";
+    for (int i = 1; i+1 < argc; i += 2) {
+        if (strcmp(argv[i], "--contexts") == 0)
+            numContexts = atoi(argv[i+1]);
+        else if (strcmp(argv[i], "--particles") == 0)
+            numParticles = atoi(argv[i+1]);
+        else if (strcmp(argv[i], "--steps") == 0)
+            steps = atoi(argv[i+1]);
+        else if (strcmp(argv[i], "--threads") == 0)
+            threadCounts = parseList(argv[i+1]);
+        else if (strcmp(argv[i], "--platform") == 0)
+            platformName = argv[i+1];
+    }
+    if (provided < MPI_THREAD_MULTIPLE)
+        printf("Warning: MPI does not provide MPI_THREAD_MULTIPLE\n");
+    int status = 0;
+    try {
+        registerPlumedReferenceKernelFactories();
+        Platform::loadPluginsFromDirectory(Platform::getDefaultPluginsDirectory());
+        FILE* log = fopen("BenchmarkConcurrentContexts.log", "w");
+        printf("%d contexts of %d particles, %d steps each, on the %s platform (%u hardware threads)\n", numContexts,
+                numParticles, steps, platformName.c_str(), thread::hardware_concurrency());
+        printf("%-10s %14s %18s %12s\n", "threads", "seconds", "context steps/s", "efficiency");
+        double baseline = 0.0;
+        for (int numThreads : threadCounts) {
+            vector<exception_ptr> errors(numThreads);
+            vector<thread> threads;
+            auto start = chrono::steady_clock::now();
+            for (int t = 0; t < numThreads; t++)
+                threads.push_back(thread([&, t] () {
+                    try {
+                        stepContexts(t, numThreads, numContexts, numParticles, steps, platformName, log);
+                    }
+                    catch (...) {
+                        errors[t] = current_exception();
+                    }
+                }));
+            for (auto& t : threads)
+                t.join();
+            double seconds = chrono::duration<double>(chrono::steady_clock::now()-start).count();
+            for (auto& error : errors)
+                if (error)
+                    rethrow_exception(error);
+            double throughput = numContexts*(double) steps/seconds;
+            if (baseline == 0.0)
+                baseline = throughput/threadCounts[0];
+            printf("%-10d %14.3f %18.1f %12.2f\n", numThreads, seconds, throughput, throughput/(baseline*numThreads));
+        }
+        fclose(log);
+    }
+    catch(const exception& e) {
+        cout << "exception: " << e.what() << endl;
+        status = 1;
+    }
+    MPI_Finalize();
+    return status;
+}
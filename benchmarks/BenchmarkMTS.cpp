@@ -0,0 +1,160 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+
+/**
+ * This program measures what putting a PlumedForce in a slow force group of a multiple time step integrator saves
+ * over computing it every step.  Usage:
+ *
+ *     BenchmarkMTS [--particles 500] [--steps 400] [--substeps 1,2,4,8] [--platform Reference]
+ *
+ * The system is a chain held by stiff bonds in force group 0, with a PLUMED coordination number over all particles in
+ * force group 1.  For each number of substeps n, an integrator with the program of OpenMM's MTSIntegrator computes
+ * the bonds every 1 fs and PLUMED every n fs, simulating the same time in steps/n steps of n fs.  With one substep,
+ * PLUMED is computed every step.  The program reports the wall time, the number of PLUMED computations and the
+ * speedup over one substep.
+ */
+
+#include "PlumedForce.h"
+#include "openmm/Context.h"
+#include "openmm/CustomIntegrator.h"
+#include "openmm/HarmonicBondForce.h"
+#include "openmm/Platform.h"
+#include "openmm/System.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <mpi.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+extern "C" OPENMM_EXPORT void registerPlumedReferenceKernelFactories();
+
+static vector<int> parseList(const string& list) {
+    vector<int> values;
+    stringstream stream(list);
+    string item;
+    while (getline(stream, item, ','))
+        values.push_back(atoi(item.c_str()));
+    return values;
+}
+
+/**
+ * Create an integrator with the program of MTSIntegrator, computing force group 1 every step and force group 0 in
+ * substeps.
+ */
+static CustomIntegrator* createMTSIntegrator(double dt, int substeps) {
+    CustomIntegrator* integrator = new CustomIntegrator(dt);
+    integrator->addPerDofVariable("x1", 0);
+    integrator->addUpdateContextState();
+    integrator->addComputePerDof("v", "v+0.5*dt*f1/m");
+    for (int i = 0; i < substeps; i++) {
+        string step = "(dt/"+to_string(substeps)+")";
+        integrator->addComputePerDof("v", "v+0.5*"+step+"*f0/m");
+        integrator->addComputePerDof("x1", "x");
+        integrator->addComputePerDof("x", "x+"+step+"*v");
+        integrator->addConstrainPositions();
+        integrator->addComputePerDof("v", "(x-x1)/"+step);
+        integrator->addComputePerDof("v", "v+0.5*"+step+"*f0/m");
+    }
+    integrator->addComputePerDof("v", "v+0.5*dt*f1/m");
+    return integrator;
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int numParticles = 500, steps = 400;
+    vector<int> substepCounts = {1, 2, 4, 8};
+    string platformName = "Reference";
+    for (int i = 1; i+1 < argc; i += 2) {
+        if (strcmp(argv[i], "--particles") == 0)
+            numParticles = atoi(argv[i+1]);
+        else if (strcmp(argv[i], "--steps") == 0)
+            steps = atoi(argv[i+1]);
+        else if (strcmp(argv[i], "--substeps") == 0)
+            substepCounts = parseList(argv[i+1]);
+        else if (strcmp(argv[i], "--platform") == 0)
+            platformName = argv[i+1];
+    }
+    int status = 0;
+    try {
+        registerPlumedReferenceKernelFactories();
+        Platform::loadPluginsFromDirectory(Platform::getDefaultPluginsDirectory());
+        FILE* log = fopen("BenchmarkMTS.log", "w");
+        printf("%d particles, %d fs on the %s platform\n", numParticles, steps, platformName.c_str());
+        printf("%-10s %14s %20s %10s\n", "substeps", "seconds", "PLUMED computations", "speedup");
+        double baseline = 0.0;
+        for (int substeps : substepCounts) {
+            System system;
+            HarmonicBondForce* bonds = new HarmonicBondForce();
+            vector<Vec3> positions(numParticles);
+            for (int i = 0; i < numParticles; i++) {
+                system.addParticle(12.0);
+                positions[i] = Vec3(0.15*(i%10), 0.15*((i/10)%10), 0.15*(i/100));
+                if (i > 0)
+                    bonds->addBond(i-1, i, 0.15, 200000.0);
+            }
+            system.addForce(bonds);
+            stringstream script;
+            script << "c: COORDINATION GROUPA=1-" << numParticles << " R_0=0.3\n"
+                   << "RESTRAINT ARG=c AT=" << numParticles << " KAPPA=0.01\n";
+            PlumedForce* force = new PlumedForce(script.str(), MPI_COMM_SELF, MPI_COMM_SELF);
+            force->setLogStream(log);
+            force->setForceGroup(1);
+            system.addForce(force);
+            unique_ptr<CustomIntegrator> integrator(createMTSIntegrator(0.001*substeps, substeps));
+            Context context(system, *integrator, Platform::getPlatformByName(platformName));
+            context.setPositions(positions);
+            context.setVelocitiesToTemperature(300.0, 1);
+            auto start = chrono::steady_clock::now();
+            integrator->step(steps/substeps);
+            double seconds = chrono::duration<double>(chrono::steady_clock::now()-start).count();
+            double computations = force->getValueStorage(context)->getCounters()[PlumedValueStorage::NumCalculations];
+            if (baseline == 0.0)
+                baseline = seconds*substepCounts[0];
+            printf("%-10d %14.3f %20.0f %10.2f\n", substeps, seconds, computations, baseline/seconds);
+        }
+        fclose(log);
+    }
+    catch(const exception& e) {
+        cout << "exception: " << e.what() << endl;
+        status = 1;
+    }
+    MPI_Finalize();
+    return status;
+}
@@ -0,0 +1,216 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This program checks how the plugin scales with the number of particles and the number of replicas.  Run it under
+ * MPI with one rank per replica:
+ *
+ *     mpirun -np 8 BenchmarkScaling [--sizes 1000,10000,100000,1000000] [--steps 100] [--platform Reference]
+ *                                   [--output scaling.csv] [--deterministic]
+ *
+ * For every size, each replica computes the radius of gyration of its own copy of the system (the replicas differ
+ * by a scale factor) and ENSEMBLE averages it over the replicas, with a RESTRAINT on the average.  Correctness is
+ * checked against single-replica runs of the same systems: the recorded average and the bias must match the mean
+ * of the single-replica values.  Then the time per step is measured, and the first rank appends a row per size to
+ * the output file.  benchmarks/run_scaling.sh sweeps the replica counts.  With --deterministic the forces run in
+ * deterministic mode (see PlumedForce::setDeterministic()), so comparing the two modes gives its cost.  PLUMED only
+ * runs on several threads when PLUMED_NUM_THREADS is set, so set it to the number of cores of each replica for that
+ * comparison; with one core or without it both modes run on a single thread.
+ */
+
+#include "PlumedForce.h"
+#include "openmm/Context.h"
+#include "openmm/Platform.h"
+#include "openmm/State.h"
+#include "openmm/System.h"
+#include "openmm/VerletIntegrator.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mpi.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+extern "C" OPENMM_EXPORT void registerPlumedReferenceKernelFactories();
+
+struct ScalingResult {
+    double value, bias, secondsPerStep;
+};
+
+static const double restraintCenter = 1.0, restraintForceConstant = 10.0;
+
+static vector<Vec3> createPositions(int numParticles, int replica) {
+    int side = 1;
+    while (side*side*side < numParticles)
+        side++;
+    double spacing = 0.3*(1.0+0.01*replica);
+    vector<Vec3> positions(numParticles);
+    for (int i = 0; i < numParticles; i++)
+        positions[i] = Vec3(i%side, (i/side)%side, i/(side*side))*spacing;
+    return positions;
+}
+
+/**
+ * Create a Context for one replica, take two steps with a tiny time step so that PLUMED records the value (the first
+ * calculation of a Context records nothing), and time the following steps.
+ */
+static ScalingResult runReplica(int numParticles, int replica, MPI_Comm interComm, bool ensemble, int steps, const string& platformName, bool deterministic, FILE* log) {
+    stringstream script;
+    script << "rg: GYRATION ATOMS=1-" << numParticles << "\n";
+    string label = "rg";
+    if (ensemble) {
+        script << "ens: ENSEMBLE ARG=rg\n";
+        label = "ens.rg";
+    }
+    script << "RESTRAINT ARG=" << label << " AT=" << restraintCenter << " KAPPA=" << restraintForceConstant << "\n";
+    System system;
+    for (int i = 0; i < numParticles; i++)
+        system.addParticle(1.0);
+    PlumedForce* force = new PlumedForce(script.str(), MPI_COMM_SELF, interComm);
+    force->setCollectiveVariables({label});
+    force->setLogStream(log);
+    force->setDeterministic(deterministic);
+    system.addForce(force);
+    VerletIntegrator integrator(1e-12);
+    Context context(system, integrator, Platform::getPlatformByName(platformName));
+    context.setPositions(createPositions(numParticles, replica));
+    integrator.step(2);
+    ScalingResult result;
+    vector<double> values;
+    force->getCollectiveVariableValues(context, values);
+    result.value = values[0];
+    result.bias = force->getBiasEnergy(context);
+    result.secondsPerStep = 0.0;
+    if (steps > 0) {
+        MPI_Barrier(MPI_COMM_WORLD);
+        auto start = chrono::steady_clock::now();
+        integrator.step(steps);
+        result.secondsPerStep = chrono::duration<double>(chrono::steady_clock::now()-start).count()/steps;
+    }
+    return result;
+}
+
+static vector<int> parseSizes(const string& list) {
+    vector<int> sizes;
+    stringstream stream(list);
+    string item;
+    while (getline(stream, item, ','))
+        sizes.push_back((int) atof(item.c_str()));
+    return sizes;
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int rank, numReplicas;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &numReplicas);
+    vector<int> sizes = {1000, 10000, 100000, 1000000};
+    int steps = 100;
+    string platformName = "Reference", output = "scaling.csv";
+    bool deterministic = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--deterministic") == 0)
+            deterministic = true;
+        else if (i+1 == argc)
+            break;
+        else if (strcmp(argv[i], "--sizes") == 0)
+            sizes = parseSizes(argv[++i]);
+        else if (strcmp(argv[i], "--steps") == 0)
+            steps = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--platform") == 0)
+            platformName = argv[++i];
+        else if (strcmp(argv[i], "--output") == 0)
+            output = argv[++i];
+    }
+    const char* threads = getenv("PLUMED_NUM_THREADS");
+    if (deterministic && rank == 0 && (threads == NULL || atoi(threads) <= 1))
+        cerr << "BenchmarkScaling: PLUMED_NUM_THREADS is not above 1, so PLUMED runs on one thread in both modes and "
+                "this run does not show the cost of the deterministic mode" << endl;
+    int failures = 0;
+    try {
+        registerPlumedReferenceKernelFactories();
+        Platform::loadPluginsFromDirectory(Platform::getDefaultPluginsDirectory());
+        FILE* log = fopen(("BenchmarkScaling."+to_string(rank)+".log").c_str(), "w");
+        FILE* csv = NULL;
+        if (rank == 0) {
+            csv = fopen(output.c_str(), "a");
+            if (ftell(csv) == 0)
+                fprintf(csv, "platform,deterministic,replicas,particles,steps,ms_per_step,steps_per_second,particle_steps_per_second,max_value_error,max_bias_error\n");
+            printf("%-10s %-10s %12s %12s %14s %14s\n", "replicas", "particles", "ms/step", "steps/s", "value error", "bias error");
+        }
+        for (int numParticles : sizes) {
+            // The reference: every replica on its own.  The replicas then agree on the expected average.
+
+            ScalingResult single = runReplica(numParticles, rank, MPI_COMM_SELF, false, 0, platformName, deterministic, log);
+            double expectedValue;
+            MPI_Allreduce(&single.value, &expectedValue, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+            expectedValue /= numReplicas;
+            double expectedBias = 0.5*restraintForceConstant*(expectedValue-restraintCenter)*(expectedValue-restraintCenter);
+
+            // The ensemble run.
+
+            ScalingResult result = runReplica(numParticles, rank, MPI_COMM_WORLD, true, steps, platformName, deterministic, log);
+            double errors[2] = {fabs(result.value-expectedValue)/fabs(expectedValue), fabs(result.bias-expectedBias)/max(fabs(expectedBias), 1e-10)};
+            double maxErrors[2], maxTime;
+            MPI_Reduce(errors, maxErrors, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            MPI_Reduce(&result.secondsPerStep, &maxTime, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+            if (rank == 0) {
+                bool passed = (maxErrors[0] < 1e-6 && maxErrors[1] < 1e-5);
+                if (!passed)
+                    failures++;
+                double stepsPerSecond = (maxTime > 0 ? 1.0/maxTime : 0.0);
+                printf("%-10d %-10d %12.4f %12.2f %14.3g %14.3g%s\n", numReplicas, numParticles, 1000*maxTime, stepsPerSecond,
+                        maxErrors[0], maxErrors[1], passed ? "" : "  FAILED");
+                fprintf(csv, "%s,%d,%d,%d,%d,%g,%g,%g,%g,%g\n", platformName.c_str(), (int) deterministic, numReplicas, numParticles, steps, 1000*maxTime,
+                        stepsPerSecond, stepsPerSecond*numParticles*numReplicas, maxErrors[0], maxErrors[1]);
+                fflush(csv);
+            }
+        }
+        if (csv != NULL)
+            fclose(csv);
+        fclose(log);
+    }
+    catch(const exception& e) {
+        cout << "exception: " << e.what() << endl;
+        MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+    MPI_Bcast(&failures, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    MPI_Finalize();
+    return (failures == 0 ? 0 : 1);
+}
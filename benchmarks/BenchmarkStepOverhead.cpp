@@ -0,0 +1,156 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This program measures the per-step cost of talking to PLUMED for small systems, where dispatching commands is a
+ * significant part of the work.  It reports
+ *
+ *  - the time of a single command sent through PlumedKernelHandle,
+ *  - the time of the command sequence a kernel sends every step, with a trivial PLUMED script, and
+ *  - the time of a full step of a Reference platform Context with a PlumedForce.
+ *
+ * Build it once with the default configuration and once with PLUMED_STATIC_KERNEL=ON to see how much the C wrapper
+ * costs.  Usage: BenchmarkStepOverhead [repetitions]
+ */
+
+#include "PlumedForce.h"
+#include "internal/PlumedKernelHandle.h"
+#include "openmm/Context.h"
+#include "openmm/Platform.h"
+#include "openmm/System.h"
+#include "openmm/VerletIntegrator.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <mpi.h>
+#include <vector>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+extern "C" OPENMM_EXPORT void registerPlumedReferenceKernelFactories();
+
+static const char* script = "d: DISTANCE ATOMS=1,2\nRESTRAINT ARG=d AT=0.5 KAPPA=1\n";
+
+static double elapsedMicroseconds(chrono::steady_clock::time_point start, int repetitions) {
+    return chrono::duration<double, micro>(chrono::steady_clock::now()-start).count()/repetitions;
+}
+
+static vector<Vec3> createPositions(int numParticles) {
+    vector<Vec3> positions(numParticles);
+    for (int i = 0; i < numParticles; i++)
+        positions[i] = Vec3(i%10, (i/10)%10, i/100)*0.3;
+    return positions;
+}
+
+static void benchmarkCommands(int numParticles, int repetitions, FILE* log) {
+    PlumedKernelHandle plumedmain;
+    plumedmain.create();
+    double timestep = 0.001;
+    plumedmain.cmd("setMDEngine", "OpenMM");
+    plumedmain.cmd("setLog", log);
+    plumedmain.cmd("setNatoms", &numParticles);
+    plumedmain.cmd("setTimestep", &timestep);
+    plumedmain.cmd("init");
+    plumedmain.cmd("readInputLines", script);
+    vector<Vec3> positions = createPositions(numParticles), forces(numParticles);
+    vector<double> masses(numParticles, 1.0);
+    double virial[9], bias;
+
+    // A single command.
+
+    int step = 0;
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; i++)
+        plumedmain.cmd("setStep", &step);
+    double single = elapsedMicroseconds(start, repetitions);
+
+    // The commands of one step, as sent by ReferenceCalcPlumedForceKernel::execute().
+
+    start = chrono::steady_clock::now();
+    for (step = 0; step < repetitions; step++) {
+        plumedmain.cmd("setStep", &step);
+        plumedmain.cmd("setMasses", &masses[0]);
+        plumedmain.cmd("setPositions", &positions[0][0]);
+        plumedmain.cmd("setForces", &forces[0][0]);
+        plumedmain.cmd("setVirial", &virial[0], 9);
+        plumedmain.cmd("prepareCalc");
+        plumedmain.cmd("performCalc");
+        plumedmain.cmd("getBias", &bias);
+    }
+    double sequence = elapsedMicroseconds(start, repetitions);
+    printf("%-12d %14.3f %14.3f", numParticles, single, sequence);
+}
+
+static void benchmarkContext(int numParticles, int repetitions, FILE* log) {
+    System system;
+    for (int i = 0; i < numParticles; i++)
+        system.addParticle(1.0);
+    PlumedForce* force = new PlumedForce(script, MPI_COMM_SELF, MPI_COMM_SELF);
+    force->setLogStream(log);
+    system.addForce(force);
+    VerletIntegrator integrator(1e-6);
+    Context context(system, integrator, Platform::getPlatformByName("Reference"));
+    context.setPositions(createPositions(numParticles));
+    integrator.step(10);
+    auto start = chrono::steady_clock::now();
+    integrator.step(repetitions);
+    printf(" %14.3f\n", elapsedMicroseconds(start, repetitions));
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int repetitions = (argc > 1 ? atoi(argv[1]) : 20000);
+    try {
+        registerPlumedReferenceKernelFactories();
+        FILE* log = fopen("BenchmarkStepOverhead.log", "w");
+#ifdef PLUMED_STATIC_KERNEL
+        printf("PLUMED linked statically, microseconds per call\n");
+#else
+        printf("PLUMED through the C wrapper, microseconds per call\n");
+#endif
+        printf("%-12s %14s %14s %14s\n", "particles", "command", "step commands", "context step");
+        for (int numParticles : {2, 10, 100, 1000}) {
+            benchmarkCommands(numParticles, repetitions, log);
+            benchmarkContext(numParticles, repetitions, log);
+        }
+        fclose(log);
+    }
+    catch(const exception& e) {
+        cout << "exception: " << e.what() << endl;
+        MPI_Finalize();
+        return 1;
+    }
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,118 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Counting heap allocations.  Global operator new and delete are replaced to count the allocations and bytes of
+ * the whole program, and a benchmark::MemoryManager reports them for each benchmark, so the JSON output has
+ * allocs_per_iter and max_bytes_used next to the times.  Google Benchmark measures the allocations in an extra run
+ * after the timed ones, so they do not affect the times.  Allocations made with malloc (e.g. by the PLUMED C
+ * wrapper) are not counted.
+ */
+
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// Every block is preceded by a header holding its size, so that delete can account for the bytes it frees.  The
+// header keeps the alignment malloc guarantees.
+
+static const size_t headerSize = alignof(std::max_align_t);
+static std::atomic<int64_t> numAllocations(0), bytesInUse(0), maxBytesInUse(0);
+
+static void* countedAllocate(size_t size) {
+    char* block = (char*) malloc(size+headerSize);
+    if (block == NULL)
+        throw std::bad_alloc();
+    *((size_t*) block) = size;
+    numAllocations++;
+    int64_t inUse = (bytesInUse += size);
+    int64_t peak = maxBytesInUse.load();
+    while (inUse > peak && !maxBytesInUse.compare_exchange_weak(peak, inUse))
+        ;
+    return block+headerSize;
+}
+
+static void countedFree(void* pointer) {
+    if (pointer == NULL)
+        return;
+    char* block = (char*) pointer-headerSize;
+    bytesInUse -= *((size_t*) block);
+    free(block);
+}
+
+void* operator new(size_t size) {
+    return countedAllocate(size);
+}
+
+void* operator new[](size_t size) {
+    return countedAllocate(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    countedFree(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    countedFree(pointer);
+}
+
+class AllocationCounter : public benchmark::MemoryManager {
+public:
+    void Start() {
+        startAllocations = numAllocations.load();
+        startBytes = bytesInUse.load();
+        maxBytesInUse = startBytes;
+    }
+    void Stop(Result* result) {
+        result->num_allocs = numAllocations.load()-startAllocations;
+        result->max_bytes_used = maxBytesInUse.load()-startBytes;
+        result->net_heap_growth = bytesInUse.load()-startBytes;
+    }
+    void Stop(Result& result) {
+        Stop(&result);
+    }
+private:
+    int64_t startAllocations, startBytes;
+};
+
+static AllocationCounter allocationCounter;
+static int registered = (benchmark::RegisterMemoryManager(&allocationCounter), 0);
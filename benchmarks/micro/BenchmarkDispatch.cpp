@@ -0,0 +1,87 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Dispatching commands to PLUMED through PlumedKernelHandle: a single command, and the sequence of commands a
+ * kernel sends every step with a trivial bias, for which the cost is mostly dispatch and atom bookkeeping.  Compare
+ * builds with and without PLUMED_STATIC_KERNEL.
+ */
+
+#include "MicroBenchmarks.h"
+#include "internal/PlumedKernelHandle.h"
+#include <cstdio>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+static void initializePlumed(PlumedKernelHandle& plumedmain, int numParticles) {
+    static FILE* log = fopen("PlumedMicroBenchmarks.log", "w");
+    double timestep = 0.001;
+    plumedmain.create();
+    plumedmain.cmd("setMDEngine", "OpenMM");
+    plumedmain.cmd("setLog", log);
+    plumedmain.cmd("setNatoms", &numParticles);
+    plumedmain.cmd("setTimestep", &timestep);
+    plumedmain.cmd("init");
+    plumedmain.cmd("readInputLines", "d: DISTANCE ATOMS=1,2\nRESTRAINT ARG=d AT=0.5 KAPPA=1\n");
+}
+
+static void BM_SingleCommand(benchmark::State& state) {
+    PlumedKernelHandle plumedmain;
+    initializePlumed(plumedmain, 1000);
+    int step = 0;
+    for (auto _ : state)
+        plumedmain.cmd("setStep", &step);
+}
+BENCHMARK(BM_SingleCommand);
+
+static void BM_StepCommands(benchmark::State& state) {
+    int numParticles = state.range(0);
+    PlumedKernelHandle plumedmain;
+    initializePlumed(plumedmain, numParticles);
+    vector<Vec3> positions = MicroBenchmarkData::getPositions(numParticles), forces(numParticles);
+    vector<double> masses(numParticles, 1.0);
+    double virial[9], bias;
+    int step = 0;
+    for (auto _ : state) {
+        plumedmain.cmd("setStep", &step);
+        plumedmain.cmd("setMasses", &masses[0]);
+        plumedmain.cmd("setPositions", &positions[0][0]);
+        plumedmain.cmd("setForces", &forces[0][0]);
+        plumedmain.cmd("setVirial", &virial[0], 9);
+        plumedmain.cmd("prepareCalc");
+        plumedmain.cmd("performCalc");
+        plumedmain.cmd("getBias", &bias);
+        step++;
+    }
+}
+BENCHMARK(BM_StepCommands)->PLUMED_MICRO_SIZES;
@@ -0,0 +1,86 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Packing the forces computed by PLUMED into the pinned upload buffer, as CudaCalcPlumedForceKernel::CopyForcesTask
+ * (on a ThreadPool) and the OpenCL kernel (on one thread) do it.
+ */
+
+#include "MicroBenchmarks.h"
+#include "internal/PlumedForcePacking.h"
+#include "openmm/internal/ThreadPool.h"
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+template <class T>
+class PackForcesTask : public ThreadPool::Task {
+public:
+    PackForcesTask(const vector<Vec3>& forces, T* buffer) : forces(forces), buffer(buffer) {
+    }
+    void execute(ThreadPool& threads, int threadIndex) {
+        int numParticles = forces.size();
+        int numThreads = threads.getNumThreads();
+        packPlumedForces(forces, buffer, threadIndex*numParticles/numThreads, (threadIndex+1)*numParticles/numThreads);
+    }
+    const vector<Vec3>& forces;
+    T* buffer;
+};
+
+template <class T>
+static void BM_PackForces(benchmark::State& state) {
+    const vector<Vec3>& forces = MicroBenchmarkData::getPositions(state.range(0));
+    vector<T> buffer(3*forces.size());
+    for (auto _ : state) {
+        packPlumedForces(forces, &buffer[0], 0, forces.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations()*buffer.size()*sizeof(T));
+}
+BENCHMARK_TEMPLATE(BM_PackForces, float)->PLUMED_MICRO_SIZES;
+BENCHMARK_TEMPLATE(BM_PackForces, double)->PLUMED_MICRO_SIZES;
+
+template <class T>
+static void BM_CopyForcesTask(benchmark::State& state) {
+    static ThreadPool threads;
+    const vector<Vec3>& forces = MicroBenchmarkData::getPositions(state.range(0));
+    vector<T> buffer(3*forces.size());
+    PackForcesTask<T> task(forces, &buffer[0]);
+    for (auto _ : state) {
+        threads.execute(task);
+        threads.waitForThreads();
+    }
+    state.SetBytesProcessed(state.iterations()*buffer.size()*sizeof(T));
+    state.counters["threads"] = threads.getNumThreads();
+}
+BENCHMARK_TEMPLATE(BM_CopyForcesTask, float)->PLUMED_MICRO_SIZES->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CopyForcesTask, double)->PLUMED_MICRO_SIZES->UseRealTime();
@@ -0,0 +1,137 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * The OpenCL addForces stage: uploading the packed PLUMED forces and running the addForces kernel from
+ * plumedForce.cl.  It uses the OpenCL API directly rather than an OpenMM Context, so that it can run on a CPU
+ * runtime such as PoCL on machines without a GPU.  A CPU device is preferred when one is available.
+ */
+
+#define CL_TARGET_OPENCL_VERSION 120
+#ifdef __APPLE__
+#include <OpenCL/opencl.h>
+#else
+#include <CL/cl.h>
+#endif
+#include "MicroBenchmarks.h"
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace PlumedPlugin;
+using namespace std;
+
+/**
+ * The OpenCL objects shared by all sizes.  If no device or compiler is available, error describes why.
+ */
+struct OpenCLEnvironment {
+    OpenCLEnvironment() : device(NULL), context(NULL), queue(NULL) {
+        cl_uint numPlatforms = 0;
+        if (clGetPlatformIDs(0, NULL, &numPlatforms) != CL_SUCCESS || numPlatforms == 0) {
+            error = "no OpenCL platform is available";
+            return;
+        }
+        vector<cl_platform_id> platforms(numPlatforms);
+        clGetPlatformIDs(numPlatforms, &platforms[0], NULL);
+        for (cl_device_type type : {CL_DEVICE_TYPE_CPU, CL_DEVICE_TYPE_ALL})
+            for (cl_platform_id platform : platforms)
+                if (device == NULL && clGetDeviceIDs(platform, type, 1, &device, NULL) != CL_SUCCESS)
+                    device = NULL;
+        if (device == NULL) {
+            error = "no OpenCL device is available";
+            return;
+        }
+        cl_int status;
+        context = clCreateContext(NULL, 1, &device, NULL, NULL, &status);
+        if (status == CL_SUCCESS)
+            queue = clCreateCommandQueue(context, device, 0, &status);
+        if (status != CL_SUCCESS)
+            error = "failed to create an OpenCL context";
+    }
+    ~OpenCLEnvironment() {
+        if (queue != NULL)
+            clReleaseCommandQueue(queue);
+        if (context != NULL)
+            clReleaseContext(context);
+    }
+    cl_device_id device;
+    cl_context context;
+    cl_command_queue queue;
+    string error;
+};
+
+static void BM_OpenCLAddForces(benchmark::State& state) {
+    static OpenCLEnvironment env;
+    if (!env.error.empty()) {
+        state.SkipWithError(env.error.c_str());
+        return;
+    }
+    int numParticles = state.range(0);
+    ifstream file(PLUMED_OPENCL_KERNEL_SOURCE);
+    stringstream source;
+    source << "#define real float\n#define real3 float3\n#define real4 float4\n#define NUM_ATOMS " << numParticles << "\n" << file.rdbuf();
+    string sourceString = source.str();
+    const char* sourcePointer = sourceString.c_str();
+    cl_int status;
+    cl_program program = clCreateProgramWithSource(env.context, 1, &sourcePointer, NULL, &status);
+    if (clBuildProgram(program, 1, &env.device, NULL, NULL, NULL) != CL_SUCCESS) {
+        clReleaseProgram(program);
+        state.SkipWithError("failed to compile plumedForce.cl");
+        return;
+    }
+    cl_kernel kernel = clCreateKernel(program, "addForces", &status);
+
+    // Fill the buffers the way the OpenCL kernel does: packed forces in the original order, and per-atom indices.
+
+    vector<float> forces(3*numParticles, 0.5f), forceBuffers(4*numParticles, 0.0f);
+    vector<cl_int> atomIndex(numParticles);
+    for (int i = 0; i < numParticles; i++)
+        atomIndex[i] = (i*7919)%numParticles;
+    cl_mem forcesBuffer = clCreateBuffer(env.context, CL_MEM_READ_ONLY, forces.size()*sizeof(float), NULL, &status);
+    cl_mem forceBuffersBuffer = clCreateBuffer(env.context, CL_MEM_READ_WRITE|CL_MEM_COPY_HOST_PTR, forceBuffers.size()*sizeof(float), &forceBuffers[0], &status);
+    cl_mem atomIndexBuffer = clCreateBuffer(env.context, CL_MEM_READ_ONLY|CL_MEM_COPY_HOST_PTR, atomIndex.size()*sizeof(cl_int), &atomIndex[0], &status);
+    clSetKernelArg(kernel, 0, sizeof(cl_mem), &forcesBuffer);
+    clSetKernelArg(kernel, 1, sizeof(cl_mem), &forceBuffersBuffer);
+    clSetKernelArg(kernel, 2, sizeof(cl_mem), &atomIndexBuffer);
+    size_t globalSize = numParticles;
+    for (auto _ : state) {
+        clEnqueueWriteBuffer(env.queue, forcesBuffer, CL_FALSE, 0, forces.size()*sizeof(float), &forces[0], 0, NULL, NULL);
+        clEnqueueNDRangeKernel(env.queue, kernel, 1, NULL, &globalSize, NULL, 0, NULL, NULL);
+        clFinish(env.queue);
+    }
+    state.SetItemsProcessed(state.iterations()*numParticles);
+    clReleaseMemObject(forcesBuffer);
+    clReleaseMemObject(forceBuffersBuffer);
+    clReleaseMemObject(atomIndexBuffer);
+    clReleaseKernel(kernel);
+    clReleaseProgram(program);
+}
+BENCHMARK(BM_OpenCLAddForces)->PLUMED_MICRO_SIZES->UseRealTime();
@@ -0,0 +1,79 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Setting up the particle data PLUMED needs: the masses and charges every kernel gathers when it is initialized,
+ * and the physical masses recovered from a System with repartitioned hydrogen masses.
+ */
+
+#include "MicroBenchmarks.h"
+#include "PlumedForce.h"
+#include "internal/PlumedForceImpl.h"
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+static void BM_SystemMasses(benchmark::State& state) {
+    const System& system = MicroBenchmarkData::getSystem(state.range(0));
+    PlumedForce force("", MPI_COMM_SELF, MPI_COMM_SELF);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(PlumedForceImpl::getParticleMasses(system, force));
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(BM_SystemMasses)->PLUMED_MICRO_SIZES;
+
+static void BM_SharedMasses(benchmark::State& state) {
+    const System& system = MicroBenchmarkData::getSystem(state.range(0));
+    PlumedForce force("", MPI_COMM_SELF, MPI_COMM_SELF);
+    force.setMasses(vector<double>(state.range(0), 1.0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(PlumedForceImpl::getParticleMasses(system, force));
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(BM_SharedMasses)->PLUMED_MICRO_SIZES;
+
+static void BM_Charges(benchmark::State& state) {
+    const System& system = MicroBenchmarkData::getSystem(state.range(0));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(PlumedForceImpl::getParticleCharges(system));
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(BM_Charges)->PLUMED_MICRO_SIZES;
+
+static void BM_MassRepartitioning(benchmark::State& state) {
+    const System& system = MicroBenchmarkData::getSystem(state.range(0));
+    PlumedForce force("", MPI_COMM_SELF, MPI_COMM_SELF);
+    for (auto _ : state)
+        force.setMassesFromTopologyRepartitioning(system, MicroBenchmarkData::hydrogenMass);
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(BM_MassRepartitioning)->PLUMED_MICRO_SIZES;
@@ -0,0 +1,79 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Extracting the positions from a Context, which the GPU kernels do with ContextImpl::getPositions() every step.
+ * The public path through Context::getState() is measured on the Reference platform and, when its plugin can be
+ * loaded, on the CPU platform, which stores the particles reordered like the GPU platforms.
+ */
+
+#include "MicroBenchmarks.h"
+#include "openmm/Context.h"
+#include "openmm/Platform.h"
+#include "openmm/State.h"
+#include "openmm/VerletIntegrator.h"
+#include <string>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+static void benchmarkPositions(benchmark::State& state, const string& platformName) {
+    static bool loaded = false;
+    if (!loaded) {
+        Platform::loadPluginsFromDirectory(Platform::getDefaultPluginsDirectory());
+        loaded = true;
+    }
+    Platform* platform;
+    try {
+        platform = &Platform::getPlatformByName(platformName);
+    }
+    catch (...) {
+        state.SkipWithError(("the "+platformName+" platform is not available").c_str());
+        return;
+    }
+    VerletIntegrator integrator(0.001);
+    Context context(MicroBenchmarkData::getSystem(state.range(0)), integrator, *platform);
+    context.setPositions(MicroBenchmarkData::getPositions(state.range(0)));
+    for (auto _ : state)
+        benchmark::DoNotOptimize(context.getState(State::Positions).getPositions().data());
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+
+static void BM_GetPositionsReference(benchmark::State& state) {
+    benchmarkPositions(state, "Reference");
+}
+BENCHMARK(BM_GetPositionsReference)->PLUMED_MICRO_SIZES;
+
+static void BM_GetPositionsCPU(benchmark::State& state) {
+    benchmarkPositions(state, "CPU");
+}
+BENCHMARK(BM_GetPositionsCPU)->PLUMED_MICRO_SIZES;
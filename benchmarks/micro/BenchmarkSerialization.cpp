@@ -0,0 +1,71 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * Serializing a PlumedForce through PlumedForceProxy.  The per-particle masses dominate the size of the XML.
+ */
+
+#include "MicroBenchmarks.h"
+#include "PlumedForce.h"
+#include "openmm/serialization/XmlSerializer.h"
+#include <memory>
+#include <sstream>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+static void BM_SerializeForce(benchmark::State& state) {
+    PlumedForce force("d: DISTANCE ATOMS=1,2\nRESTRAINT ARG=d AT=0.5 KAPPA=1\n", MPI_COMM_SELF, MPI_COMM_SELF);
+    force.setMasses(vector<double>(state.range(0), 1.008));
+    for (auto _ : state) {
+        stringstream buffer;
+        XmlSerializer::serialize<PlumedForce>(&force, "Force", buffer);
+        benchmark::DoNotOptimize(buffer.str().size());
+    }
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(BM_SerializeForce)->PLUMED_MICRO_SIZES->Unit(benchmark::kMillisecond);
+
+static void BM_DeserializeForce(benchmark::State& state) {
+    PlumedForce force("d: DISTANCE ATOMS=1,2\nRESTRAINT ARG=d AT=0.5 KAPPA=1\n", MPI_COMM_SELF, MPI_COMM_SELF);
+    force.setMasses(vector<double>(state.range(0), 1.008));
+    stringstream serialized;
+    XmlSerializer::serialize<PlumedForce>(&force, "Force", serialized);
+    string xml = serialized.str();
+    for (auto _ : state) {
+        stringstream buffer(xml);
+        unique_ptr<PlumedForce> copy(XmlSerializer::deserialize<PlumedForce>(buffer));
+        benchmark::DoNotOptimize(copy->getMasses().size());
+    }
+    state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+BENCHMARK(BM_DeserializeForce)->PLUMED_MICRO_SIZES->Unit(benchmark::kMillisecond);
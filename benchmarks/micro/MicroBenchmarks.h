@@ -0,0 +1,98 @@
+#ifndef OPENMM_PLUMED_MICROBENCHMARKS_H_
+#define OPENMM_PLUMED_MICROBENCHMARKS_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "openmm/NonbondedForce.h"
+#include "openmm/System.h"
+#include "openmm/Vec3.h"
+#include <benchmark/benchmark.h>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace PlumedPlugin {
+
+/**
+ * The system sizes every stage is measured at: 1k, 10k, 100k and 1M particles.
+ */
+#define PLUMED_MICRO_SIZES RangeMultiplier(10)->Range(1000, 1000000)
+
+/**
+ * The fixtures shared by the micro benchmarks.  Systems and positions are created once per size and cached, so that
+ * building them is not part of any measurement.
+ */
+class MicroBenchmarkData {
+public:
+    /**
+     * Get a System of water-like triplets (one heavy particle and two hydrogens with repartitioned masses of
+     * 3 Da, constrained to it), with a NonbondedForce that holds the charges.
+     */
+    static const OpenMM::System& getSystem(int numParticles) {
+        static std::map<int, std::unique_ptr<OpenMM::System> > systems;
+        std::unique_ptr<OpenMM::System>& system = systems[numParticles];
+        if (!system) {
+            system.reset(new OpenMM::System());
+            OpenMM::NonbondedForce* nonbonded = new OpenMM::NonbondedForce();
+            for (int i = 0; i < numParticles; i++) {
+                bool hydrogen = (i%3 != 0);
+                system->addParticle(hydrogen ? hydrogenMass : 15.999-2*(hydrogenMass-1.007947));
+                nonbonded->addParticle(hydrogen ? 0.417 : -0.834, 0.3, 0.5);
+                if (hydrogen)
+                    system->addConstraint(i-i%3, i, 0.1);
+            }
+            system->addForce(nonbonded);
+        }
+        return *system;
+    }
+    /**
+     * Get positions on a cubic lattice with a spacing of 0.3 nm.
+     */
+    static const std::vector<OpenMM::Vec3>& getPositions(int numParticles) {
+        static std::map<int, std::vector<OpenMM::Vec3> > positions;
+        std::vector<OpenMM::Vec3>& result = positions[numParticles];
+        if (result.empty()) {
+            int side = 1;
+            while (side*side*side < numParticles)
+                side++;
+            result.resize(numParticles);
+            for (int i = 0; i < numParticles; i++)
+                result[i] = OpenMM::Vec3(i%side, (i/side)%side, i/(side*side))*0.3;
+        }
+        return result;
+    }
+    static constexpr double hydrogenMass = 3.0;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMED_MICROBENCHMARKS_H_*/
@@ -0,0 +1,69 @@
+"""
+Compare two runs of PlumedMicroBenchmarks and fail if any stage became slower.
+
+    PlumedMicroBenchmarks --benchmark_out=baseline.json
+    ... change the code and rebuild ...
+    PlumedMicroBenchmarks --benchmark_out=candidate.json
+    python compare.py baseline.json candidate.json --threshold 0.1
+
+Every benchmark present in both files is compared by its time per iteration.  When the runs were made with
+--benchmark_repetitions, the medians are compared.  The exit status is 1 if any benchmark is slower than the
+baseline by more than the threshold (a fraction, 0.1 is 10%), and 0 otherwise.
+"""
+
+import argparse
+import json
+import statistics
+import sys
+
+
+def load(path, metric):
+    """Get a dict from benchmark name to time per iteration in nanoseconds."""
+    scale = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+    with open(path) as f:
+        data = json.load(f)
+    times = {}
+    for b in data['benchmarks']:
+        if b.get('run_type', 'iteration') != 'iteration' or 'error_occurred' in b:
+            continue
+        name = b.get('run_name', b['name'])
+        times.setdefault(name, []).append(b[metric]*scale[b.get('time_unit', 'ns')])
+    return {name: statistics.median(values) for name, values in times.items()}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two Google Benchmark JSON outputs of PlumedMicroBenchmarks.')
+    parser.add_argument('baseline', help='the JSON output of the reference run')
+    parser.add_argument('candidate', help='the JSON output of the run to check')
+    parser.add_argument('--threshold', type=float, default=0.1, help='the largest allowed slowdown, as a fraction (default 0.1)')
+    parser.add_argument('--metric', choices=['real_time', 'cpu_time'], default='real_time', help='the time to compare (default real_time)')
+    parser.add_argument('--filter', default='', help='only compare benchmarks whose names contain this string')
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    candidate = load(args.candidate, args.metric)
+    names = [name for name in baseline if name in candidate and args.filter in name]
+    if len(names) == 0:
+        print('compare.py: the two files have no benchmarks in common')
+        return 1
+    regressions = []
+    width = max(len(name) for name in set(baseline) | set(candidate))
+    print('%-*s %14s %14s %9s' % (width, 'Benchmark', 'Baseline (ns)', 'Candidate (ns)', 'Change'))
+    for name in names:
+        change = candidate[name]/baseline[name]-1
+        flag = ''
+        if change > args.threshold:
+            regressions.append(name)
+            flag = '  REGRESSION'
+        print('%-*s %14.1f %14.1f %+8.1f%%%s' % (width, name, baseline[name], candidate[name], 100*change, flag))
+    for name in sorted(set(baseline) ^ set(candidate)):
+        if args.filter in name:
+            print('%-*s only in %s' % (width, name, args.baseline if name in baseline else args.candidate))
+    if len(regressions) > 0:
+        print('%d of %d benchmarks are more than %g%% slower' % (len(regressions), len(names), 100*args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,193 @@
+"""
+Render the results of plugin benchmark runs made at different commits as static HTML and CSV comparison tables.
+
+    python report.py results/v1.2 results/a1b2c3d --output report
+
+Each argument is the directory of one run, and the first one is the baseline.  A run directory holds any of
+
+  *.json   the output of benchmarks/workload.py (the script/simulate.py workload, one file per platform) and of
+           PlumedMicroBenchmarks --benchmark_out=... --benchmark_out_format=json (per-stage times and allocations)
+  *.csv    the output of BenchmarkScaling (throughput over particle and replica counts)
+
+A run is labelled with the commit recorded by workload.py, or else with the name of its directory; --labels
+overrides both.  The output directory receives index.html, which needs no network access, and one CSV file per
+table:
+
+  workload.csv     ns/day of the workload per platform and replica count
+  phases.csv       time per step of the workload spent in each phase (calculation, transfer, replica_wait, other)
+  micro.csv        time per iteration of each micro benchmark (median over repetitions)
+  allocations.csv  heap allocations per iteration of each micro benchmark
+  scaling.csv      scaling efficiency per platform: the throughput with n replicas divided by n times the
+                   throughput with one replica
+
+Every table compares the last run with the baseline.  Changes for the worse larger than --threshold are
+highlighted, and with --fail-on-regression the exit status is then 1.
+"""
+
+import argparse
+import collections
+import csv
+import glob
+import html
+import json
+import os
+import statistics
+import sys
+
+Table = collections.namedtuple('Table', ['name', 'title', 'keys', 'unit', 'higherIsBetter', 'rows'])
+
+
+class Run(object):
+    """The results of the benchmarks of one run, read from its directory."""
+
+    def __init__(self, directory):
+        self.directory = directory
+        self.label = os.path.basename(os.path.normpath(directory))
+        self.workload = {}
+        self.phases = {}
+        self.micro = {}
+        self.allocations = {}
+        self.scaling = {}
+        for path in sorted(glob.glob(os.path.join(directory, '*.json'))):
+            with open(path) as f:
+                data = json.load(f)
+            if data.get('benchmark') == 'workload':
+                self.readWorkload(data)
+            elif 'benchmarks' in data:
+                self.readMicro(data)
+        for path in sorted(glob.glob(os.path.join(directory, '*.csv'))):
+            with open(path) as f:
+                rows = list(csv.DictReader(f))
+            if len(rows) > 0 and 'particle_steps_per_second' in rows[0]:
+                self.readScaling(rows)
+
+    def readWorkload(self, data):
+        if data.get('commit'):
+            self.label = data['commit']
+        key = (data['platform'], data['replicas'])
+        self.workload[key] = data['ns_per_day']
+        for phase, value in data['phases_ms_per_step'].items():
+            self.phases[key+(phase,)] = value
+
+    def readMicro(self, data):
+        scale = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+        times = collections.defaultdict(list)
+        for b in data['benchmarks']:
+            if b.get('run_type', 'iteration') != 'iteration' or 'error_occurred' in b:
+                continue
+            name = b.get('run_name', b['name'])
+            times[name].append(b['real_time']*scale[b.get('time_unit', 'ns')])
+            if 'allocs_per_iter' in b:
+                self.allocations[(name,)] = b['allocs_per_iter']
+        for name, values in times.items():
+            self.micro[(name,)] = statistics.median(values)
+
+    def readScaling(self, rows):
+        # Several files or repeated measurements of the same case are averaged.
+
+        throughput = collections.defaultdict(list)
+        for row in rows:
+            key = (row['platform'], row.get('deterministic', '0'), int(row['particles']), int(row['replicas']))
+            throughput[key].append(float(row['particle_steps_per_second']))
+        throughput = {key: statistics.mean(values) for key, values in throughput.items()}
+        for (platform, deterministic, particles, replicas), value in throughput.items():
+            single = throughput.get((platform, deterministic, particles, 1))
+            if single:
+                self.scaling[(platform, 'yes' if deterministic == '1' else 'no', particles, replicas)] = value/(replicas*single)
+
+
+def buildTables(runs):
+    """Collect every measured quantity into tables whose rows map a key to the values of the runs."""
+    specs = [('workload', 'Workload speed', ['platform', 'replicas'], 'ns/day', True),
+             ('phases', 'Workload time per phase', ['platform', 'replicas', 'phase'], 'ms/step', False),
+             ('micro', 'Micro benchmarks', ['benchmark'], 'ns', False),
+             ('allocations', 'Allocations', ['benchmark'], 'allocations/iteration', False),
+             ('scaling', 'Scaling efficiency', ['platform', 'deterministic', 'particles', 'replicas'], 'efficiency', True)]
+    tables = []
+    for name, title, keys, unit, higherIsBetter in specs:
+        allKeys = set()
+        for run in runs:
+            allKeys.update(getattr(run, name))
+        rows = collections.OrderedDict((key, [getattr(run, name).get(key) for run in runs]) for key in sorted(allKeys))
+        tables.append(Table(name, title, keys, unit, higherIsBetter, rows))
+    return tables
+
+
+def change(table, values):
+    """Get the relative change of the last run from the baseline, and whether it is a change for the worse."""
+    if len(values) < 2 or values[0] is None or values[-1] is None or values[0] == 0:
+        return None, 0.0
+    relative = values[-1]/values[0]-1
+    return relative, (-relative if table.higherIsBetter else relative)
+
+
+def writeCsv(table, labels, path):
+    with open(path, 'w', newline='') as f:
+        writer = csv.writer(f)
+        writer.writerow(table.keys+labels+['change'])
+        for key, values in table.rows.items():
+            relative, worse = change(table, values)
+            writer.writerow(list(key)+['' if v is None else '%.6g' % v for v in values]+['' if relative is None else '%.4f' % relative])
+
+
+def writeHtml(tables, labels, threshold, path):
+    out = ['<!DOCTYPE html>', '<html><head><meta charset="utf-8"><title>OpenMM PLUMED plugin benchmarks</title>',
+           '<style>body{font-family:sans-serif;margin:2em}table{border-collapse:collapse;margin-bottom:2em}'
+           'th,td{border:1px solid #ccc;padding:0.2em 0.6em;text-align:right}th{background:#eee}'
+           'td.key{text-align:left}td.worse{background:#f8c8c8}td.better{background:#c8f0c8}</style></head><body>',
+           '<h1>OpenMM PLUMED plugin benchmarks</h1>',
+           '<p>Baseline: %s.  Changes of the last run (%s) beyond %.0f%% are highlighted.</p>' %
+           (html.escape(labels[0]), html.escape(labels[-1]), 100*threshold)]
+    for table in tables:
+        if len(table.rows) == 0:
+            continue
+        out.append('<h2>%s (%s)</h2><table><tr>' % (html.escape(table.title), html.escape(table.unit)))
+        out.append(''.join('<th>%s</th>' % html.escape(h) for h in table.keys+labels+['change']))
+        out.append('</tr>')
+        for key, values in table.rows.items():
+            relative, worse = change(table, values)
+            cells = ['<td class="key">%s</td>' % html.escape(str(k)) for k in key]
+            cells += ['<td>%s</td>' % ('' if v is None else '%.4g' % v) for v in values]
+            style = ''
+            if relative is not None and worse > threshold:
+                style = ' class="worse"'
+            elif relative is not None and -worse > threshold:
+                style = ' class="better"'
+            cells.append('<td%s>%s</td>' % (style, '' if relative is None else '%+.1f%%' % (100*relative)))
+            out.append('<tr>%s</tr>' % ''.join(cells))
+        out.append('</table>')
+    out.append('</body></html>')
+    with open(path, 'w') as f:
+        f.write('\n'.join(out)+'\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Render benchmark runs of the plugin as HTML and CSV comparison tables.')
+    parser.add_argument('runs', nargs='+', help='the directories of the runs, the baseline first')
+    parser.add_argument('--labels', nargs='+', help='the labels of the runs (default: the commit or the directory name)')
+    parser.add_argument('--output', default='report', help='the directory to write the report to (default report)')
+    parser.add_argument('--threshold', type=float, default=0.05, help='the relative change to highlight (default 0.05)')
+    parser.add_argument('--fail-on-regression', action='store_true', help='exit with status 1 if the last run is worse beyond the threshold')
+    args = parser.parse_args()
+
+    runs = [Run(directory) for directory in args.runs]
+    labels = [run.label for run in runs]
+    if args.labels is not None:
+        if len(args.labels) != len(runs):
+            parser.error('there must be one label per run')
+        labels = args.labels
+    tables = buildTables(runs)
+    os.makedirs(args.output, exist_ok=True)
+    for table in tables:
+        writeCsv(table, labels, os.path.join(args.output, table.name+'.csv'))
+    writeHtml(tables, labels, args.threshold, os.path.join(args.output, 'index.html'))
+    regressions = [(table.title, key) for table in tables for key, values in table.rows.items()
+                   if change(table, values)[0] is not None and change(table, values)[1] > args.threshold]
+    for title, key in regressions:
+        print('Regression in %s: %s' % (title, ', '.join(str(k) for k in key)))
+    print('Report written to %s' % os.path.join(args.output, 'index.html'))
+    return 1 if args.fail_on_regression and len(regressions) > 0 else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,19 @@
+#!/bin/sh
+# This script sweeps BenchmarkScaling over replica counts, writing all results to one CSV file
+# Usage: run_scaling.sh [output.csv] [extra BenchmarkScaling arguments...]
+# It runs in the build directory.  $MPIRUN (default mpirun) launches the ranks, and $REPLICAS (default
+# "1 2 4 8 16 32") lists the replica counts; counts beyond the available cores may need e.g. MPIRUN="mpirun --oversubscribe".
+
+set -eu
+
+OUTPUT=${1:-scaling.csv}
+shift || true
+MPIRUN=${MPIRUN:-mpirun}
+REPLICAS=${REPLICAS:-"1 2 4 8 16 32"}
+STATUS=0
+
+for NUM_REPLICAS in $REPLICAS; do
+    $MPIRUN -np "$NUM_REPLICAS" ./benchmarks/BenchmarkScaling --output "$OUTPUT" "$@" || STATUS=1
+done
+echo "Results written to $OUTPUT"
+exit $STATUS
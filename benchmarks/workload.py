@@ -0,0 +1,130 @@
+"""
+Time the production workload of script/simulate.py and write the result as JSON for benchmarks/report.
+
+    cd script
+    mpirun -np 2 python ../benchmarks/workload.py --platform CUDA --steps 2000 --output workload_CUDA.json
+
+The System, the PLUMED script and the integrator are those of simulate.py: its sequence and PLUMED script are read
+from the file, so the benchmark follows any change made to it.  The simulation starts from input.pdb instead of the
+checkpoint, whose format depends on the platform, and does not write output files apart from PLUMED's own.  Like
+simulate.py, it runs one replica per MPI rank.
+
+After --warmup steps, --steps steps are timed.  The JSON file records the speed in ns/day and, per step, the time
+spent by PLUMED (calculation), in moving positions and forces between OpenMM and PLUMED (transfer), waiting for the
+other replicas (replica_wait, see PlumedForce.setLoadBalanceReport()) and in the rest of OpenMM (other).  With
+several replicas the slowest one is reported.
+"""
+
+import argparse
+import ast
+import datetime
+import json
+import os
+import subprocess
+import time
+
+from mpi4py import MPI
+import numpy as np
+from openmm import LangevinIntegrator, Platform
+from openmm.app import PDBFile, Simulation
+from openmm.unit import kelvin, picosecond, picoseconds
+
+from openmmplumed import PlumedForce, CalvadosSystemBuilder, ExclusionFile, views
+
+
+def read_workload(path):
+    """Get the sequence and the PLUMED script assigned in simulate.py, without running it."""
+    with open(path) as f:
+        tree = ast.parse(f.read(), path)
+    strings = {}
+    for node in ast.walk(tree):
+        if isinstance(node, ast.Assign) and len(node.targets) == 1 and isinstance(node.targets[0], ast.Name):
+            value = node.value
+            # fasta = """...""".replace('\n', '')
+            if isinstance(value, ast.Call) and isinstance(value.func, ast.Attribute):
+                value = value.func.value
+            if isinstance(value, ast.Constant) and isinstance(value.value, str):
+                strings[node.targets[0].id] = value.value
+    return strings['fasta'].replace('\n', ''), strings['script']
+
+
+def current_commit():
+    """Get the commit of the plugin checkout this file belongs to, or None if it is not a git checkout."""
+    try:
+        return subprocess.check_output(['git', 'rev-parse', '--short', 'HEAD'], cwd=os.path.dirname(os.path.abspath(__file__)),
+                                       stderr=subprocess.DEVNULL).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Time the script/simulate.py workload and write the result as JSON.')
+    parser.add_argument('--platform', default='CUDA', help='the OpenMM platform (default CUDA)')
+    parser.add_argument('--steps', type=int, default=2000, help='the number of timed steps (default 2000)')
+    parser.add_argument('--warmup', type=int, default=200, help='the number of steps before timing starts (default 200)')
+    parser.add_argument('--workload', default='simulate.py', help='the workload script, run from its directory (default simulate.py)')
+    parser.add_argument('--commit', default=None, help='the label of the run (default: the current git commit)')
+    parser.add_argument('--output', default='workload.json', help='the JSON file to write (default workload.json)')
+    args = parser.parse_args()
+
+    comm = MPI.COMM_WORLD
+    fasta, script = read_workload(args.workload)
+    pdb = PDBFile('input.pdb')
+    builder = CalvadosSystemBuilder()
+    builder.loadResidueTable('residues.csv')
+    builder.addChain(fasta)
+    builder.setCutoffs(4, 2)
+    system = builder.createSystem()
+    exclusions = ExclusionFile('r1_excl.bin')
+    exclusions.addExclusionsTo(system.getForce(1))
+    exclusions.addExclusionsTo(system.getForce(2))
+    force = PlumedForce(script, MPI.COMM_SELF, comm)
+    system.addForce(force)
+    integrator = LangevinIntegrator(298*kelvin, 0.01/picosecond, 0.005*picoseconds)
+    simulation = Simulation(pdb.topology, system, integrator, Platform.getPlatformByName(args.platform))
+    simulation.context.setPositions(pdb.positions)
+    simulation.step(args.warmup)
+
+    counters = force.getValueViews(simulation.context).counters
+    before = np.array(counters)
+    comm.Barrier()
+    start = time.perf_counter()
+    simulation.step(args.steps)
+    seconds = time.perf_counter()-start
+    used = np.array(counters)-before
+
+    # Report the slowest replica.
+
+    seconds, rank = comm.allreduce((seconds, comm.rank), op=MPI.MAXLOC)
+    used = comm.bcast(used, root=rank)
+    def perStep(value):
+        return 1000*value/args.steps
+    phases = {'calculation': perStep(used[views.CalculationTime]),
+              'transfer': perStep(used[views.TransferTime]),
+              'replica_wait': perStep(used[views.ReplicaWaitTime])}
+    phases['other'] = perStep(seconds)-sum(phases.values())
+    if comm.rank == 0:
+        timestep = integrator.getStepSize().value_in_unit(picoseconds)
+        result = {
+            'benchmark': 'workload',
+            'workload': os.path.basename(args.workload),
+            'commit': args.commit or current_commit(),
+            'date': datetime.datetime.now().isoformat(timespec='seconds'),
+            'platform': args.platform,
+            'replicas': comm.size,
+            'particles': system.getNumParticles(),
+            'steps': args.steps,
+            'timestep_ps': timestep,
+            'seconds': seconds,
+            'ms_per_step': perStep(seconds),
+            'ns_per_day': args.steps*timestep*1e-3/seconds*86400,
+            'plumed_calculations': int(used[views.NumCalculations]),
+            'phases_ms_per_step': phases
+        }
+        with open(args.output, 'w') as f:
+            json.dump(result, f, indent=2)
+        print('%s: %.1f ns/day, %.3f ms/step' % (args.platform, result['ns_per_day'], result['ms_per_step']))
+
+
+if __name__ == '__main__':
+    main()
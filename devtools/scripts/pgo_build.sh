@@ -0,0 +1,42 @@
+# This script builds the plugin with profile guided optimization
+# It configures an instrumented build, runs a training workload, and rebuilds with the recorded profiles
+# Usage: pgo_build.sh [build directory] [extra CMake arguments...]
+# The training workload is $PGO_TRAINING_COMMAND, run in the build directory (by default the benchmark suite)
+
+set -euo pipefail
+
+SOURCE_DIR=$(cd "$(dirname "$0")/../.." && pwd)
+BUILD_DIR=${1:-build-pgo}
+shift || true
+mkdir -p "$BUILD_DIR"
+BUILD_DIR=$(cd "$BUILD_DIR" && pwd)
+PROFILE_DIR="$BUILD_DIR/pgo-profiles"
+
+# The default workload runs the benchmarks, so the profile follows the simulation paths rather than the unit tests
+# The micro benchmarks skip their million particle cases, which take very long in an instrumented build
+DEFAULT_TRAINING_COMMAND="./benchmarks/BenchmarkStepOverhead \
+    && ./benchmarks/BenchmarkScaling --sizes 1000,10000,100000 --steps 50 --output pgo_scaling.csv \
+    && ./benchmarks/BenchmarkMTS --steps 200 \
+    && ./benchmarks/BenchmarkConcurrentContexts --steps 100 \
+    && if [ -x ./benchmarks/micro/PlumedMicroBenchmarks ]; then ./benchmarks/micro/PlumedMicroBenchmarks --benchmark_min_time=0.05 --benchmark_filter='/(1000|10000|100000)\$'; fi"
+TRAINING_COMMAND=${PGO_TRAINING_COMMAND:-$DEFAULT_TRAINING_COMMAND}
+
+# Instrumented build
+rm -rf "$PROFILE_DIR"
+cmake -S "$SOURCE_DIR" -B "$BUILD_DIR" -DCMAKE_BUILD_TYPE=Release -DPLUMED_BUILD_BENCHMARKS=ON -DPLUMED_PGO=GENERATE -DPLUMED_PGO_DIR="$PROFILE_DIR" "$@"
+cmake --build "$BUILD_DIR" -j
+
+# Training run; a failed workload leaves partial or empty profiles, which must not be used for the optimized build
+if ! (cd "$BUILD_DIR" && sh -c "$TRAINING_COMMAND"); then
+    echo "pgo_build.sh: the training workload failed" >&2
+    exit 1
+fi
+
+# Clang writes raw profiles that have to be merged
+if ls "$PROFILE_DIR"/*.profraw > /dev/null 2>&1; then
+    llvm-profdata merge -output="$PROFILE_DIR/default.profdata" "$PROFILE_DIR"/*.profraw
+fi
+
+# Optimized build
+cmake -S "$SOURCE_DIR" -B "$BUILD_DIR" -DPLUMED_PGO=USE "$@"
+cmake --build "$BUILD_DIR" -j
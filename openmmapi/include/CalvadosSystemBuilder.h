@@ -0,0 +1,154 @@
+#ifndef OPENMM_CALVADOSSYSTEMBUILDER_H_
+#define OPENMM_CALVADOSSYSTEMBUILDER_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "openmm/System.h"
+#include <map>
+#include <string>
+#include <vector>
+#include "internal/windowsExportPlumed.h"
+
+namespace PlumedPlugin {
+
+/**
+ * This class builds the coarse-grained System of the CALVADOS model, with one particle per residue, directly from
+ * a list of sequences and a table of residue parameters.  It is a much faster replacement for generating a force
+ * field XML file and calling ForceField.createSystem(), especially for systems made of many chains.
+ *
+ * The System contains, in this order:
+ *
+ * <ol>
+ * <li>A HarmonicBondForce connecting consecutive residues of each chain.</li>
+ * <li>A CustomNonbondedForce with the Debye-Huckel (Yukawa) electrostatics.</li>
+ * <li>A CustomNonbondedForce with the Ashbaugh-Hatch short range interactions, in force group 1.</li>
+ * </ol>
+ *
+ * Bonded pairs are excluded from both nonbonded forces.  The first and last residues of each chain carry the
+ * terminal charges (+1 and -1) and masses (+2 and +16 Da), and the charge of histidine depends on the pH.
+ *
+ * For example:
+ *
+ * <tt><pre>
+ * CalvadosSystemBuilder builder;
+ * builder.loadResidueTable("residues.csv");
+ * for (int i = 0; i < 100; i++)
+ *     builder.addChain(sequence);
+ * builder.setPeriodicBoxVectors(Vec3(30, 0, 0), Vec3(0, 30, 0), Vec3(0, 0, 30));
+ * System* system = builder.createSystem();
+ * </pre></tt>
+ */
+
+class OPENMM_EXPORT_PLUMED CalvadosSystemBuilder {
+public:
+    /**
+     * Create a CalvadosSystemBuilder with the default CALVADOS conditions: 298 K, an ionic strength of 0.2 M,
+     * pH 7.4, cutoffs of 4 nm (Yukawa) and 2 nm (Ashbaugh-Hatch), and bonds of length 0.38 nm with a force constant
+     * of 8033 kJ/mol/nm^2.
+     */
+    CalvadosSystemBuilder();
+    /**
+     * Define the parameters of a residue type.
+     *
+     * @param code      the one letter code of the residue
+     * @param mass      the mass, measured in Dalton
+     * @param charge    the charge, in units of the proton charge
+     * @param sigma     the Ashbaugh-Hatch diameter, measured in nm
+     * @param lambda    the Ashbaugh-Hatch hydropathy
+     */
+    void setResidueType(char code, double mass, double charge, double sigma, double lambda);
+    /**
+     * Define residue types from a CSV file with (at least) the columns "one", "MW", "q", "sigmas" and a column of
+     * hydropathies, such as the residues.csv file of CALVADOS.
+     *
+     * @param file            the path of the CSV file
+     * @param lambdaColumn    the name of the column holding the hydropathies
+     */
+    void loadResidueTable(const std::string& file, const std::string& lambdaColumn="lambdas");
+    /**
+     * Add a chain to the System.  Its particles follow those of the chains added before.
+     *
+     * @param sequence    the one letter codes of the residues of the chain
+     * @return the index of the first particle of the chain
+     */
+    int addChain(const std::string& sequence);
+    /**
+     * Get the number of chains that have been added.
+     */
+    int getNumChains() const;
+    /**
+     * Get the total number of residues in all chains.
+     */
+    int getNumParticles() const;
+    /**
+     * Set the temperature, measured in Kelvin, used for the Yukawa parameters.
+     */
+    void setTemperature(double temperature);
+    /**
+     * Set the ionic strength, measured in molar, used for the Yukawa screening length.
+     */
+    void setIonicStrength(double ionicStrength);
+    /**
+     * Set the pH, which determines the charge of histidine.
+     */
+    void setPH(double pH);
+    /**
+     * Set the cutoff distances, measured in nm, of the Yukawa and Ashbaugh-Hatch interactions.
+     */
+    void setCutoffs(double yukawaCutoff, double ashbaughHatchCutoff);
+    /**
+     * Set the length (in nm) and force constant (in kJ/mol/nm^2) of the bonds.
+     */
+    void setBondParameters(double length, double k);
+    /**
+     * Make the System periodic with the given box.  By default it is not periodic.
+     */
+    void setPeriodicBoxVectors(const OpenMM::Vec3& a, const OpenMM::Vec3& b, const OpenMM::Vec3& c);
+    /**
+     * Create the System.  The caller takes ownership of it.
+     */
+    OpenMM::System* createSystem() const;
+private:
+    struct ResidueType {
+        double mass, charge, sigma, lambda;
+    };
+    std::map<char, ResidueType> residueTypes;
+    std::vector<std::string> chains;
+    int numParticles;
+    double temperature, ionicStrength, pH, yukawaCutoff, ashbaughHatchCutoff, bondLength, bondK;
+    bool periodic;
+    OpenMM::Vec3 boxVectors[3];
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_CALVADOSSYSTEMBUILDER_H_*/
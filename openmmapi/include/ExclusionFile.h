@@ -0,0 +1,117 @@
+#ifndef OPENMM_EXCLUSIONFILE_H_
+#define OPENMM_EXCLUSIONFILE_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "openmm/CustomNonbondedForce.h"
+#include <string>
+#include <utility>
+#include <vector>
+#include "internal/windowsExportPlumed.h"
+
+namespace PlumedPlugin {
+
+/**
+ * This class reads a binary list of particle pairs, such as nonbonded exclusions or bonds, and applies it to
+ * forces in bulk.  On POSIX systems the file is memory mapped, so opening even a very large list costs little more
+ * than the I/O.
+ *
+ * The format is little endian and consists of a 24 byte header followed by the pairs:
+ *
+ * <ul>
+ * <li>8 bytes: the magic string "OMMPEXCL"</li>
+ * <li>uint32: the format version, currently 1</li>
+ * <li>uint32: reserved, must be 0</li>
+ * <li>uint64: the number of pairs N</li>
+ * <li>N times two int32: the (zero based) particle indices of each pair</li>
+ * </ul>
+ *
+ * Files can be written with write(), or by any tool that follows this layout.  The pairs are used where they are
+ * mapped, without conversion, so reading and writing files throws an exception on big endian hosts.
+ */
+
+class OPENMM_EXPORT_PLUMED ExclusionFile {
+public:
+    /**
+     * Write a list of pairs to a file.
+     *
+     * @param path     the path of the file to create
+     * @param pairs    the particle pairs to write
+     */
+    static void write(const std::string& path, const std::vector<std::pair<int, int> >& pairs);
+    /**
+     * Open a file and check its header.  An exception is thrown if it is not a valid exclusion file.
+     *
+     * @param path     the path of the file to read
+     */
+    explicit ExclusionFile(const std::string& path);
+    ~ExclusionFile();
+    /**
+     * Get the number of pairs in the file.
+     */
+    long long getNumPairs() const;
+    /**
+     * Get the particles of a pair.
+     *
+     * @param index        the index of the pair
+     * @param particle1    the index of the first particle is stored into this
+     * @param particle2    the index of the second particle is stored into this
+     */
+    void getPair(long long index, int& particle1, int& particle2) const;
+    /**
+     * Get a pointer to the 2*getNumPairs() particle indices, which are stored pair by pair.
+     */
+    const int* getData() const;
+    /**
+     * Add every pair as an exclusion to a CustomNonbondedForce.  Pairs that the force already excludes are skipped,
+     * so the same list can be applied on top of the bonded exclusions.  An exception is thrown, before the force is
+     * changed, if a pair refers to a particle the force does not have or to the same particle twice.
+     *
+     * @param force    the force to add the exclusions to
+     * @return the number of exclusions that were added
+     */
+    int addExclusionsTo(OpenMM::CustomNonbondedForce& force) const;
+private:
+    ExclusionFile(const ExclusionFile&);
+    ExclusionFile& operator=(const ExclusionFile&);
+    void unmap();
+    std::string path;
+    const int* pairs;
+    long long numPairs;
+    void* mapping;
+    size_t mappingSize;
+    std::vector<int> buffer;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_EXCLUSIONFILE_H_*/
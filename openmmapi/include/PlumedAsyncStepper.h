@@ -0,0 +1,127 @@
+#ifndef OPENMM_PLUMEDASYNCSTEPPER_H_
+#define OPENMM_PLUMEDASYNCSTEPPER_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "PlumedForce.h"
+#include "openmm/Context.h"
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "internal/windowsExportPlumed.h"
+
+namespace PlumedPlugin {
+
+/**
+ * This class advances a Context on a background thread, so that the caller can analyze earlier results while the
+ * simulation runs.  Every <i>stride</i> steps it takes a snapshot of the bias and the recorded PLUMED values of a
+ * PlumedForce (see PlumedForce::setCollectiveVariables()) and stores it in a ring buffer, from which
+ * readSnapshots() drains them.  When the buffer is full the oldest snapshots are overwritten.
+ *
+ * A snapshot holds the values PLUMED computed during the last step of the stride.  While the stepper is running,
+ * the Context and its Integrator must not be used by any other thread.
+ */
+
+class OPENMM_EXPORT_PLUMED PlumedAsyncStepper {
+public:
+    /**
+     * Create a PlumedAsyncStepper.
+     *
+     * @param context    the Context to advance.  It must contain force.
+     * @param force      the PlumedForce whose values are recorded
+     * @param stride     the number of steps between snapshots
+     * @param capacity   the maximum number of snapshots kept in the ring buffer
+     */
+    PlumedAsyncStepper(OpenMM::Context& context, const PlumedForce& force, int stride, int capacity);
+    /**
+     * Waits for the current run, if any, to finish.  Errors from that run are discarded.
+     */
+    ~PlumedAsyncStepper();
+    /**
+     * Get the number of steps between snapshots.
+     */
+    int getStride() const;
+    /**
+     * Get the maximum number of snapshots kept in the ring buffer.
+     */
+    int getCapacity() const;
+    /**
+     * Get the number of doubles in each snapshot: the step index, the bias energy, and then the recorded values.
+     */
+    int getSnapshotSize() const;
+    /**
+     * Start advancing the Context by a number of steps on the background thread, and return immediately.  It is an
+     * error to call this while a previous run is still in progress.
+     *
+     * @param steps     the number of steps to take
+     */
+    void start(int steps);
+    /**
+     * Get whether a run started with start() is still in progress.
+     */
+    bool isRunning() const;
+    /**
+     * Block until the current run (if any) has finished.  If it failed, the exception it threw is rethrown here.
+     */
+    void wait();
+    /**
+     * Remove all snapshots from the ring buffer and append them, oldest first, to a vector.  Each one occupies
+     * getSnapshotSize() consecutive elements.  This may be called while a run is in progress.
+     *
+     * @param snapshots    the snapshots are appended to this
+     * @return the number of snapshots that were read
+     */
+    int readSnapshots(std::vector<double>& snapshots);
+    /**
+     * Get the number of snapshots that were overwritten before being read.
+     */
+    long long getNumDropped() const;
+private:
+    void run(int steps);
+    void record();
+    OpenMM::Context& context;
+    std::shared_ptr<PlumedValueStorage> storage;
+    int stride, capacity, snapshotSize, first, count;
+    long long dropped;
+    bool running;
+    std::vector<double> ring;
+    std::exception_ptr error;
+    std::thread thread;
+    std::mutex threadLock;
+    mutable std::mutex lock;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDASYNCSTEPPER_H_*/
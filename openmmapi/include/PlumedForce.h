@@ -33,10 +33,13 @@
  * -------------------------------------------------------------------------- */
 
 #include <mpi.h>
+#include "PlumedValueStorage.h"
 #include "openmm/Context.h"
 #include "openmm/Force.h"
 #include <cstdio>
+#include <memory>
 #include <string>
+#include <vector>
 #include "internal/windowsExportPlumed.h"
 
 namespace PlumedPlugin {
@@ -106,14 +109,39 @@ public:
      * are used.
      */
     const std::vector<double>& getMasses() const;
+    /**
+     * Get the particle masses as a shared, immutable buffer.  Copies of the force and the Contexts created from it
+     * all refer to this buffer instead of copying the masses.
+     */
+    std::shared_ptr<const std::vector<double> > getSharedMasses() const;
+    /**
+     * Set the particle masses to the physical masses of a System whose hydrogen masses have been repartitioned,
+     * e.g. by ForceField.createSystem(hydrogenMass=...).  Every particle with mass hmass that is constrained or
+     * bonded (by a HarmonicBondForce) to a particle of a different mass is taken to be a hydrogen: its mass is reset
+     * to that of hydrogen and the difference is given back to its partner, which may have been left lighter than
+     * hmass.  All other masses are kept.
+     *
+     * @param system    the System whose masses were repartitioned
+     * @param hmass     the mass given to the hydrogens, measured in Dalton
+     */
+    void setMassesFromTopologyRepartitioning(const OpenMM::System& system, double hmass);
     /**
      * Set the C stream of the PLUMED log. By default it is set to `stdout`.
+     *
+     * @param stream    the stream PLUMED writes its log to
+     * @param close     if true, the force takes ownership of the stream and closes it once neither the force nor any
+     *                  Context created from it uses it any more.  Otherwise the caller keeps it open.
      */
-    void setLogStream(FILE* stream);
+    void setLogStream(FILE* stream, bool close=false);
     /**
      * Get the C sream of the PLUMED log.
      */
     FILE* getLogStream() const;
+    /**
+     * Get the stream of the PLUMED log as a shared pointer, which keeps a stream the force owns open for as long as
+     * the pointer is held.
+     */
+    std::shared_ptr<FILE> getSharedLogStream() const;
     /**
      * Set the state of PLUMED restart (https://www.plumed.org/doc-master/user-doc/html/_r_e_s_t_a_r_t.html). By default it is `false`.
      */
@@ -122,6 +150,142 @@ public:
      * Get the state of PLUMED restart.
      */
     bool getRestart() const;
+    /**
+     * Set the labels of the PLUMED values (e.g. "d" or "p.x") to record every time PLUMED is updated for a new
+     * step.  They can then be retrieved with getCollectiveVariableValues().  By default no value is recorded.
+     */
+    void setCollectiveVariables(const std::vector<std::string>& labels);
+    /**
+     * Get the labels of the PLUMED values recorded every time PLUMED is updated for a new step.
+     */
+    const std::vector<std::string>& getCollectiveVariables() const;
+    /**
+     * Enable a report of the load balance between replicas.  At every new step, before PLUMED is called, each
+     * replica waits on the inter-replica communicator until all replicas have arrived, and records how long it
+     * computed since its previous wait and how long it waited.  Every interval steps the times are gathered, and the
+     * first replica appends to the file, for each replica and for all of them together, the mean, minimum and maximum
+     * compute time per step, the mean wait per step, and the fraction of the time spent waiting.
+     *
+     * The wait is where the blocking reductions of ENSEMBLE or METAINFERENCE would otherwise hide the slowest
+     * replica, so it synchronizes the replicas no more than those already do.  With an interval of 0 (the default)
+     * no report is made.
+     *
+     * @param interval   the number of steps between summaries, or 0 to disable the report
+     * @param filename   the file the summaries are written to
+     */
+    void setLoadBalanceReport(int interval, const std::string& filename);
+    /**
+     * Get the number of steps between load balance summaries, or 0 if no report is made.
+     */
+    int getLoadBalanceReportInterval() const;
+    /**
+     * Get the file the load balance summaries are written to.
+     */
+    const std::string& getLoadBalanceReportFile() const;
+    /**
+     * Set whether to count CPU cycles, instructions and last level cache misses with the hardware performance
+     * counters (perf_event_open, Linux only) while PLUMED computes the bias and while the forces are transferred.
+     * The counts are accumulated in the value storage, next to the timing counters.  Events the system does not
+     * allow to count, as is common in containers, are reported as -1.  Only the thread that calls PLUMED is counted,
+     * not the OpenMP threads PLUMED starts, so the calculation events are also reported as -1 when PLUMED may run
+     * on several threads (PLUMED_NUM_THREADS above 1) and the force is not deterministic.  By default this is false.
+     */
+    void setUseHardwareCounters(bool use);
+    /**
+     * Get whether the hardware performance counters are read.
+     */
+    bool getUseHardwareCounters() const;
+    /**
+     * Set whether the bias forces and the recorded values must be bitwise reproducible.  PLUMED then runs its
+     * calculations on a single OpenMP thread, so its reductions no longer depend on the number of threads.  PLUMED
+     * shares its number of threads across the process, so it is only lowered while this force computes; other
+     * PlumedForces computing at the same moment also run on one thread, and all others keep PLUMED's default
+     * (PLUMED_NUM_THREADS, or one thread).  The forces are transferred to the device and added to the other forces
+     * particle by particle, in an order that never depends on the number of threads, so nothing else changes.
+     *
+     * Sums over replicas (e.g. ENSEMBLE) are reduced by MPI in rank order, which is independent of where the
+     * replicas run as long as MPI does not select topology-aware collectives (e.g. Open MPI's han or hcoll
+     * components, which can be excluded with OMPI_MCA_coll=^han,hcoll).  The other forces of the System are not
+     * affected; on the CUDA platform set its DeterministicForces property as well.  By default this is false.
+     */
+    void setDeterministic(bool deterministic);
+    /**
+     * Get whether the bias forces and the recorded values must be bitwise reproducible.
+     */
+    bool getDeterministic() const;
+    /**
+     * Set whether the plugin may compute metadynamics itself instead of passing the script to PLUMED.  This is used
+     * when the script contains only DISTANCE and POSITION actions (without periodic boundary conditions, or with
+     * NOPBC) and a single METAD on them, using no keywords other than ARG, SIGMA, HEIGHT, PACE, BIASFACTOR, TEMP,
+     * GRID_MIN, GRID_MAX, GRID_BIN and FILE, and the force is not restarting.  The bias, the forces and the HILLS file
+     * are the same as PLUMED's, but the host round trip through PLUMED is avoided and the hills are summed in a
+     * vectorized loop, or accumulated on a grid if GRID_MIN, GRID_MAX and GRID_BIN are given.  The values that may
+     * be recorded are those of the collective variables and the bias of the METAD.  Any other script is passed to
+     * PLUMED as usual.  By default this is false.
+     */
+    void setUseNativeMetadynamics(bool use);
+    /**
+     * Get whether the plugin may compute metadynamics itself instead of passing the script to PLUMED.
+     */
+    bool getUseNativeMetadynamics() const;
+    /**
+     * Set whether COORDINATION and CONTACTMAP actions are computed by the plugin, on the device for the CUDA and
+     * OpenCL platforms, instead of by PLUMED.  The plugin then computes the switching function of every pair and its
+     * derivatives where the positions are, passes only the values of the variables to PLUMED (through EXTRACV
+     * actions that replace them in the script), and applies the forces PLUMED returns on them with the chain rule.
+     * This is used for COORDINATION with GROUPA (and optionally GROUPB), and for CONTACTMAP with SUM and ATOMSn
+     * (and optionally WEIGHTn), with either R_0, D_0, NN and MM or a RATIONAL SWITCH (which may have D_MAX).  Actions
+     * with other keywords, such as NLIST or PAIR, and NOPBC in a periodic System are computed by PLUMED as usual.
+     * By default this is false.
+     */
+    void setUseDeviceContactVariables(bool use);
+    /**
+     * Get whether COORDINATION and CONTACTMAP actions are computed by the plugin instead of by PLUMED.
+     */
+    bool getUseDeviceContactVariables() const;
+    /**
+     * Set how far (in nm) the atoms PLUMED uses may move before it has to compute the bias again.  At every force
+     * computation the plugin compares the positions of the atoms used by the actions active at that step with those
+     * of the last computation by PLUMED.  If the same atoms are used, none of them moved farther than the tolerance,
+     * and the periodic box did not change, the bias and forces of that computation are reused.  PLUMED is still
+     * updated at every step, with the values of that computation, so hills are deposited and output is written as
+     * usual.  The reused computations are counted by the ReusedCalculations counter of the value storage.
+     *
+     * This is meant for biases that only depend on the positions, such as restraints and walls, on atoms that
+     * barely move.  Their error is bounded by the change of the bias over the tolerance.  Results are only reused
+     * across steps if every action in the script is one of a few static biases (RESTRAINT, UPPER_WALLS,
+     * LOWER_WALLS, BIASVALUE), common variables, and outputs.  With any other action, such as METAD or
+     * MOVINGRESTRAINT, the bias may depend on the step or change when PLUMED is updated, so results are only reused
+     * within a step and never after an update.  Results are not reused with several replicas (whose PLUMED
+     * calculations communicate), with the native metadynamics, or when contact variables are computed by the
+     * plugin.  By default the tolerance is 0, which disables the reuse.
+     */
+    void setReuseTolerance(double tolerance);
+    /**
+     * Get how far (in nm) the atoms PLUMED uses may move before it has to compute the bias again.
+     */
+    double getReuseTolerance() const;
+    /**
+     * Get the values of the recorded PLUMED values, in the order given to setCollectiveVariables(), as of the most
+     * recent step for which PLUMED was updated in a Context.
+     *
+     * @param context    the Context for which to get the values
+     * @param values     the values are stored into this
+     */
+    void getCollectiveVariableValues(const OpenMM::Context& context, std::vector<double>& values) const;
+    /**
+     * Get the bias energy computed by PLUMED the most recent time the force was computed in a Context.
+     *
+     * @param context    the Context for which to get the bias
+     */
+    double getBiasEnergy(const OpenMM::Context& context) const;
+    /**
+     * Get the storage into which the force records its bias energy, timing counters and PLUMED values in a Context.
+     * It is updated in place every time the force is computed, so it can be read repeatedly without further calls.
+     *
+     * @param context    the Context for which to get the storage
+     */
+    std::shared_ptr<PlumedValueStorage> getValueStorage(const OpenMM::Context& context) const;
 protected:
     OpenMM::ForceImpl* createImpl() const;
 private:
@@ -129,9 +293,17 @@ private:
     MPI_Comm intra_comm;
     MPI_Comm inter_comm;
     double temperature;
-    std::vector<double> masses;
-    FILE* logStream;
+    std::shared_ptr<const std::vector<double> > masses;
+    std::shared_ptr<FILE> logStream;
     bool restart;
+    std::vector<std::string> collectiveVariables;
+    int loadBalanceInterval;
+    std::string loadBalanceFile;
+    bool useHardwareCounters;
+    bool deterministic;
+    bool useNativeMetadynamics;
+    bool useDeviceContactVariables;
+    double reuseTolerance;
 };
 
 } // namespace PlumedPlugin
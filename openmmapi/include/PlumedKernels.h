@@ -36,7 +36,9 @@
 #include "openmm/KernelImpl.h"
 #include "openmm/Platform.h"
 #include "openmm/System.h"
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace PlumedPlugin {
 
@@ -66,6 +68,26 @@ public:
      * @return the potential energy due to the force
      */
     virtual double execute(OpenMM::ContextImpl& context, bool includeForces, bool includeEnergy) = 0;
+    /**
+     * Record that the integrator is starting a time step.  This is called before it computes any forces for the step.
+     *
+     * @param context        the context in which to execute this kernel
+     */
+    virtual void beginStep(OpenMM::ContextImpl& context) = 0;
+    /**
+     * Get the values of the PLUMED values recorded during the most recent calculation.
+     *
+     * @param values     the values are stored into this
+     */
+    virtual void getCollectiveVariableValues(std::vector<double>& values) const = 0;
+    /**
+     * Get the bias energy computed by PLUMED during the most recent calculation.
+     */
+    virtual double getBiasEnergy() const = 0;
+    /**
+     * Get the storage into which the kernel records the bias, timing counters and PLUMED values.
+     */
+    virtual std::shared_ptr<PlumedValueStorage> getValueStorage() const = 0;
 };
 
 } // namespace PlumedPlugin
@@ -0,0 +1,158 @@
+#ifndef OPENMM_PLUMEDVALUESTORAGE_H_
+#define OPENMM_PLUMEDVALUESTORAGE_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include <vector>
+
+namespace PlumedPlugin {
+
+/**
+ * This class holds the values a PlumedForce records in one Context: the bias energy, a set of timing counters, and
+ * the PLUMED values selected with PlumedForce::setCollectiveVariables().  They are kept in a single contiguous array
+ * of doubles, so that they can be exposed without copying (for example as Python memoryviews).  The kernel updates
+ * the array in place every time the force is computed.
+ *
+ * The storage is shared through a std::shared_ptr, so it stays valid after the Context that filled it is deleted.
+ */
+class PlumedValueStorage {
+public:
+    /**
+     * The timing counters, in the order they are stored.
+     */
+    enum Counter {
+        /**
+         * The number of times PLUMED has computed the bias.
+         */
+        NumCalculations = 0,
+        /**
+         * The total wall clock time in seconds spent inside PLUMED.
+         */
+        CalculationTime = 1,
+        /**
+         * The total wall clock time in seconds spent passing positions to PLUMED and forces back to OpenMM.  This
+         * is zero on the Reference platform, where PLUMED works directly on OpenMM's arrays.
+         */
+        TransferTime = 2,
+        /**
+         * The total wall clock time in seconds spent waiting for the other replicas.  It is only measured when a
+         * load balance report is enabled (see PlumedForce::setLoadBalanceReport()).
+         */
+        ReplicaWaitTime = 3,
+        /**
+         * The CPU cycles, instructions and last level cache misses counted by the hardware while PLUMED computes the
+         * bias (see PlumedForce::setUseHardwareCounters()).  They are stored in the order of PlumedHardwareCounters::Event.
+         * A counter is -1 if its event cannot be counted on this system.
+         */
+        CalculationCycles = 4,
+        CalculationInstructions = 5,
+        CalculationCacheMisses = 6,
+        /**
+         * The same events, counted while the forces are packed and passed back to OpenMM.  They stay zero on the
+         * Reference platform.
+         */
+        TransferCycles = 7,
+        TransferInstructions = 8,
+        TransferCacheMisses = 9,
+        /**
+         * The number of times the bias and forces of the previous calculation were reused because the atoms did
+         * not move farther than the tolerance (see PlumedForce::setReuseTolerance()).  These are not counted in
+         * NumCalculations.
+         */
+        ReusedCalculations = 10,
+        /**
+         * The number of counters.
+         */
+        NumCounters = 11
+    };
+    /**
+     * Create a PlumedValueStorage.
+     *
+     * @param numValues    the number of PLUMED values to record
+     */
+    explicit PlumedValueStorage(int numValues) : data(1+NumCounters+numValues, 0.0) {
+    }
+    /**
+     * Get the total number of doubles in the storage.
+     */
+    int getSize() const {
+        return data.size();
+    }
+    /**
+     * Get a pointer to the whole storage: the bias, followed by the counters, followed by the values.
+     */
+    double* getData() {
+        return &data[0];
+    }
+    const double* getData() const {
+        return &data[0];
+    }
+    /**
+     * Get the bias energy computed by PLUMED the most recent time the force was computed.
+     */
+    double& getBias() {
+        return data[0];
+    }
+    double getBias() const {
+        return data[0];
+    }
+    /**
+     * Get a pointer to the NumCounters timing counters.
+     */
+    double* getCounters() {
+        return &data[1];
+    }
+    const double* getCounters() const {
+        return &data[1];
+    }
+    /**
+     * Get the number of PLUMED values that are recorded.
+     */
+    int getNumValues() const {
+        return data.size()-1-NumCounters;
+    }
+    /**
+     * Get a pointer to the recorded PLUMED values.
+     */
+    double* getValues() {
+        return &data[0]+1+NumCounters;
+    }
+    const double* getValues() const {
+        return &data[0]+1+NumCounters;
+    }
+private:
+    std::vector<double> data;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDVALUESTORAGE_H_*/
@@ -0,0 +1,131 @@
+#ifndef OPENMM_PLUMEDCONTACTVARIABLES_H_
+#define OPENMM_PLUMEDCONTACTVARIABLES_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "PlumedForce.h"
+#include "internal/windowsExportPlumed.h"
+#include "openmm/System.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PlumedPlugin {
+
+/**
+ * This class holds the COORDINATION and CONTACTMAP actions of a script that the plugin computes itself, as described
+ * in PlumedForce::setUseDeviceContactVariables().  It rewrites the script so that each of them becomes an EXTRACV
+ * whose value the kernel passes to PLUMED, and lists the pairs of atoms the kernels evaluate.  The pairs of each
+ * variable are contiguous.  The Reference platform uses computeValues() and addForces(); the other platforms copy
+ * the pairs and their parameters to the device and do the same there.
+ */
+class OPENMM_EXPORT_PLUMED PlumedContactVariables {
+public:
+    /**
+     * The parameters of the switching function of a pair, in the order they are stored for each pair.  Periodic is 1
+     * if the pair uses periodic boundary conditions and 0 otherwise.
+     */
+    enum Parameter {InvR0, D0, NN, MM, DMax, Stretch, Shift, Weight, Periodic, NumParameters};
+    /**
+     * Create a PlumedContactVariables for a force, if its script contains actions the plugin can compute.
+     *
+     * @param force      the force whose script to compute
+     * @param system     the System the force belongs to
+     * @return the variables, or a null pointer if the plugin computes none of the actions
+     */
+    static std::unique_ptr<PlumedContactVariables> create(const PlumedForce& force, const OpenMM::System& system);
+    /**
+     * Get the script to pass to PLUMED, in which the actions computed by the plugin are replaced by EXTRACV.
+     */
+    const std::string& getScript() const;
+    /**
+     * Get the number of variables computed by the plugin.
+     */
+    int getNumVariables() const;
+    /**
+     * Get the label of a variable, which is also the name of its EXTRACV.
+     */
+    const std::string& getVariableName(int index) const;
+    /**
+     * Get the index of the first pair of each variable.  This has one more element than there are variables, the
+     * last one being the number of pairs.
+     */
+    const std::vector<int>& getVariableStart() const;
+    /**
+     * Get the atoms of the pairs, two per pair.
+     */
+    const std::vector<int>& getPairAtoms() const;
+    /**
+     * Get the parameters of the pairs, NumParameters per pair.
+     */
+    const std::vector<double>& getPairParameters() const;
+    /**
+     * Get, for every atom involved in a pair, the pairs it is involved in.  The entries of atom atoms[i] are
+     * entries[start[i]] to entries[start[i+1]-1], and each is 2*pair for the first atom of the pair or 2*pair+1 for
+     * the second one.  This lets the kernels sum the forces on each atom without atomic operations.
+     */
+    void getAtomPairs(std::vector<int>& atoms, std::vector<int>& start, std::vector<int>& entries) const;
+    /**
+     * Compute the switching function of a pair.
+     *
+     * @param parameters   the parameters of the pair
+     * @param r            the distance between the atoms
+     * @param dfunc        the derivative with respect to r, divided by r, is stored into this
+     * @return the weighted value of the switching function
+     */
+    static double evaluateSwitch(const double* parameters, double r, double& dfunc);
+    /**
+     * Compute the values of the variables, and record the derivatives of every pair for addForces().
+     *
+     * @param positions    the positions of all particles (x, y and z of each one)
+     * @param boxVectors   the periodic box vectors (9 elements), or NULL if the System is not periodic
+     * @param values       the values are stored into this
+     */
+    void computeValues(const double* positions, const double* boxVectors, double* values);
+    /**
+     * Add the forces the variables apply, given the forces PLUMED applies on them, to a force array.
+     *
+     * @param variableForces   the forces on the variables (minus the derivatives of the bias)
+     * @param forces           the forces are added to this array (x, y and z of each particle)
+     */
+    void addForces(const double* variableForces, double* forces) const;
+private:
+    PlumedContactVariables();
+    std::string script;
+    std::vector<std::string> names;
+    std::vector<int> variableStart, pairAtoms;
+    std::vector<double> pairParameters, pairDerivatives;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDCONTACTVARIABLES_H_*/
@@ -0,0 +1,105 @@
+#ifndef OPENMM_PLUMEDCOORDINATEEXPORT_H_
+#define OPENMM_PLUMEDCOORDINATEEXPORT_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/windowsExportPlumed.h"
+#include "openmm/Vec3.h"
+#include "openmm/internal/ContextImpl.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace PlumedPlugin {
+
+/**
+ * This class transfers the positions of a Context from the device once per force computation for all the PlumedForces
+ * in it.  Each kernel acquires the export of its Context, which is shared by all of them and released when the last
+ * one is deleted.  At every computation each kernel asks for the atoms it needs.  The first request of a computation
+ * transfers the union of the atoms all the kernels needed last time along with the requested ones, so normally a
+ * single transfer serves every kernel; atoms that are still missing are transferred when they are requested.
+ *
+ * The positions are stored in an array with one element per particle, of which only the transferred atoms are
+ * valid.  The platform does the transfer itself, since only it knows how to gather a subset of the atoms on the
+ * device.  All calls for one Context must be made from the thread that computes its forces.
+ */
+class OPENMM_EXPORT_PLUMED PlumedCoordinateExport {
+public:
+    /**
+     * A function that transfers the positions of a list of atoms, given by their indices in the System, into the
+     * array passed to it.  If the boolean argument is true, the positions of all particles are needed instead.
+     */
+    typedef std::function<void(const std::vector<int>&, bool, std::vector<OpenMM::Vec3>&)> Transfer;
+    /**
+     * Get the export of a Context, creating it if no kernel holds it yet.
+     *
+     * @param context     the Context whose positions to export
+     */
+    static std::shared_ptr<PlumedCoordinateExport> acquire(const OpenMM::ContextImpl& context);
+    /**
+     * Register a kernel that will request positions.
+     *
+     * @return the index that identifies the kernel in the other methods
+     */
+    int addClient();
+    /**
+     * Unregister a kernel, so the atoms it needed are no longer transferred.
+     */
+    void removeClient(int client);
+    /**
+     * Get the positions of a set of atoms, transferring them if they have not already been transferred during this
+     * computation.
+     *
+     * @param client        the index returned by addClient()
+     * @param computation   identifies the force computation.  It must differ between consecutive computations.
+     * @param atoms         the atoms whose positions are needed.  Ignored if allAtoms is true.
+     * @param allAtoms      whether the positions of all particles are needed
+     * @param transfer      the function to transfer positions from the device
+     * @return the positions of all particles, of which those requested are valid
+     */
+    const std::vector<OpenMM::Vec3>& getPositions(int client, int computation, const std::vector<int>& atoms, bool allAtoms, const Transfer& transfer);
+private:
+    struct Client;
+    PlumedCoordinateExport(int numParticles);
+    void transferMissing(bool allAtoms, bool inPlace, const Transfer& transfer);
+    std::vector<Client> clients;
+    std::vector<OpenMM::Vec3> positions, scratch;
+    // The atoms whose positions are valid for the current computation, flagged in isTransferred.
+    std::vector<int> transferredAtoms, missingAtoms;
+    std::vector<char> isTransferred;
+    bool allTransferred, hasComputation;
+    int computation;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDCOORDINATEEXPORT_H_*/
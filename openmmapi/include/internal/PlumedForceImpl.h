@@ -35,14 +35,13 @@
 #include "PlumedForce.h"
 #include "openmm/internal/ForceImpl.h"
 #include "openmm/Kernel.h"
+#include <mutex>
 #include <utility>
 #include <set>
 #include <string>
 
 namespace PlumedPlugin {
 
-class System;
-
 /**
  * This is the internal implementation of PlumedForce.
  */
@@ -55,15 +54,39 @@ public:
     const PlumedForce& getOwner() const {
         return owner;
     }
-    void updateContextState(OpenMM::ContextImpl& context, bool& forcesInvalid) {
-        // This force field doesn't update the state directly.
-    }
+    void updateContextState(OpenMM::ContextImpl& context, bool& forcesInvalid);
     double calcForcesAndEnergy(OpenMM::ContextImpl& context, bool includeForces, bool includeEnergy, int groups);
     std::map<std::string, double> getDefaultParameters() {
         return std::map<std::string, double>(); // This force field doesn't define any parameters.
     }
     std::vector<std::string> getKernelNames();
     void updateParametersInContext(OpenMM::ContextImpl& context);
+    void getCollectiveVariableValues(std::vector<double>& values) const;
+    double getBiasEnergy() const;
+    std::shared_ptr<PlumedValueStorage> getValueStorage() const;
+    /**
+     * Get the particle masses to pass to PLUMED: those set on the force if there are any (shared, not copied),
+     * otherwise the masses of the System.
+     */
+    static std::shared_ptr<const std::vector<double> > getParticleMasses(const OpenMM::System& system, const PlumedForce& force);
+    /**
+     * Get the particle charges to pass to PLUMED, taken from the NonbondedForce of the System.  If there is none,
+     * the vector is empty.
+     */
+    static std::vector<double> getParticleCharges(const OpenMM::System& system);
+    /**
+     * Get the lock kernels hold while they create, set up and finalize their PLUMED instances.  Contexts may be
+     * created and destroyed from several threads at once, but neither loading the PLUMED kernel nor MPI (unless it
+     * provides MPI_THREAD_MULTIPLE) may be entered concurrently.
+     */
+    static std::mutex& getInitializationLock();
+    /**
+     * Initialize MPI if the program has not done so, asking for MPI_THREAD_MULTIPLE: PLUMED calls MPI every step,
+     * even with MPI_COMM_SELF, so Contexts stepped from different threads need it.  If MPI provides a lower level,
+     * including when the program initialized it, this prints a warning once.  The caller must hold the
+     * initialization lock.
+     */
+    static void initializeMPI();
 private:
     const PlumedForce& owner;
     OpenMM::Kernel kernel;
@@ -0,0 +1,57 @@
+#ifndef OPENMM_PLUMEDFORCEPACKING_H_
+#define OPENMM_PLUMEDFORCEPACKING_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "openmm/Vec3.h"
+#include <vector>
+
+namespace PlumedPlugin {
+
+/**
+ * Copy the forces computed by PLUMED into a buffer of consecutive x, y, z components, as uploaded to the device by
+ * the GPU platforms, converting them to the precision of the buffer.  Only particles start to end-1 are copied, so
+ * the work can be divided between threads.
+ */
+template <class T>
+void packPlumedForces(const std::vector<OpenMM::Vec3>& forces, T* buffer, int start, int end) {
+    for (int i = start; i < end; ++i) {
+        const OpenMM::Vec3& p = forces[i];
+        buffer[3*i] = (T) p[0];
+        buffer[3*i+1] = (T) p[1];
+        buffer[3*i+2] = (T) p[2];
+    }
+}
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDFORCEPACKING_H_*/
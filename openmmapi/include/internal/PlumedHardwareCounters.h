@@ -0,0 +1,135 @@
+#ifndef OPENMM_PLUMEDHARDWARECOUNTERS_H_
+#define OPENMM_PLUMEDHARDWARECOUNTERS_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/windowsExportPlumed.h"
+#include <mutex>
+
+namespace PlumedPlugin {
+
+/**
+ * This class reads the hardware performance counters of the calling thread with perf_event_open (Linux only).
+ * Each thread opens its own group of counters the first time it reads them, counting user space events only.
+ * Containers and virtual machines often do not allow this (perf_event_paranoid, seccomp) or do not expose some
+ * events, so every event can be unavailable.
+ */
+class OPENMM_EXPORT_PLUMED PlumedHardwareCounters {
+public:
+    /**
+     * The events that are counted, in the order they are stored.
+     */
+    enum Event {
+        /**
+         * CPU cycles.
+         */
+        Cycles = 0,
+        /**
+         * Retired instructions.
+         */
+        Instructions = 1,
+        /**
+         * Last level cache misses.  Multiplied by the 64 byte cache line size, this estimates the memory traffic.
+         */
+        CacheMisses = 2,
+        /**
+         * The number of events.
+         */
+        NumEvents = 3
+    };
+    /**
+     * Get whether an event can be counted on this system.
+     */
+    static bool isAvailable(Event event);
+    /**
+     * Read the counts of the calling thread.  Unavailable events read as zero.
+     *
+     * @param counts    NumEvents values are stored into this
+     */
+    static void read(long long* counts);
+    /**
+     * Prepare NumEvents consecutive counters to accumulate events: available events start at zero, and the others
+     * are set to -1.
+     *
+     * @param counters    the counters to prepare
+     * @param enabled     if false, every event is treated as unavailable
+     */
+    static void initializeCounters(double* counters, bool enabled=true);
+};
+
+/**
+ * This adds the events counted by the calling thread, from its construction to its destruction or to end(), to
+ * NumEvents consecutive counters.  Events that are not available are left alone.  If the counters are null it does
+ * nothing.
+ */
+class PlumedHardwareCounterScope {
+public:
+    /**
+     * Create a PlumedHardwareCounterScope.
+     *
+     * @param counters    the counters to add the events to, or null
+     * @param lock        if not null, this is locked while adding to the counters, for scopes on several threads
+     */
+    PlumedHardwareCounterScope(double* counters, std::mutex* lock=NULL) : counters(counters), lock(lock) {
+        if (counters != NULL)
+            PlumedHardwareCounters::read(start);
+    }
+    ~PlumedHardwareCounterScope() {
+        end();
+    }
+    /**
+     * Stop counting before the object is destroyed.
+     */
+    void end() {
+        if (counters == NULL)
+            return;
+        long long stop[PlumedHardwareCounters::NumEvents];
+        PlumedHardwareCounters::read(stop);
+        std::unique_lock<std::mutex> guard;
+        if (lock != NULL)
+            guard = std::unique_lock<std::mutex>(*lock);
+        for (int i = 0; i < PlumedHardwareCounters::NumEvents; i++)
+            if (PlumedHardwareCounters::isAvailable((PlumedHardwareCounters::Event) i))
+                counters[i] += stop[i]-start[i];
+        counters = NULL;
+    }
+private:
+    PlumedHardwareCounterScope(const PlumedHardwareCounterScope&);
+    PlumedHardwareCounterScope& operator=(const PlumedHardwareCounterScope&);
+    double* counters;
+    std::mutex* lock;
+    long long start[PlumedHardwareCounters::NumEvents];
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDHARDWARECOUNTERS_H_*/
@@ -0,0 +1,131 @@
+#ifndef OPENMM_PLUMEDKERNELHANDLE_H_
+#define OPENMM_PLUMEDKERNELHANDLE_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#ifdef PLUMED_STATIC_KERNEL
+#include "core/PlumedMain.h"
+#include <memory>
+#include <type_traits>
+#else
+#include "wrapper/Plumed.h"
+#endif
+#include <cstddef>
+
+namespace PlumedPlugin {
+
+/**
+ * This class is the PLUMED instance used by a platform kernel.  By default commands go through the PLUMED C wrapper
+ * (wrapper/Plumed.h), which locates the PLUMED kernel at run time and dispatches every command through a function
+ * pointer, translating exceptions on the way back.  When the plugin is configured with PLUMED_STATIC_KERNEL, PLUMED
+ * is linked statically into the plugin and each command is a direct call to PLMD::PlumedMain::cmd().
+ */
+class PlumedKernelHandle {
+public:
+    PlumedKernelHandle() : created(false) {
+    }
+    ~PlumedKernelHandle() {
+        finalize();
+    }
+    /**
+     * Create a new PLUMED instance, finalizing the previous one if there is one.
+     */
+    void create() {
+        finalize();
+#ifdef PLUMED_STATIC_KERNEL
+        main.reset(new PLMD::PlumedMain());
+#else
+        main = plumed_create();
+#endif
+        created = true;
+    }
+    /**
+     * Finalize the PLUMED instance.  This does nothing if none has been created.
+     */
+    void finalize() {
+        if (!created)
+            return;
+#ifdef PLUMED_STATIC_KERNEL
+        main.reset();
+#else
+        plumed_finalize(main);
+#endif
+        created = false;
+    }
+    /**
+     * Send a command that takes no argument.
+     */
+    void cmd(const char* key) {
+#ifdef PLUMED_STATIC_KERNEL
+        main->cmd(key);
+#else
+        plumed_cmd(main, key);
+#endif
+    }
+    /**
+     * Send a command with an argument.  If nelem is not zero, it is the number of elements the argument points to.
+     */
+    template <class T>
+    void cmd(const char* key, T* value, std::size_t nelem=0) {
+#ifdef PLUMED_STATIC_KERNEL
+        main->cmd(key, typesafe(value, nelem, std::is_constructible<PLMD::TypesafePtr, T*, std::size_t>()));
+#else
+        if (nelem == 0)
+            plumed_cmd(main, key, value);
+        else
+            plumed_cmd(main, key, value, nelem);
+#endif
+    }
+private:
+    PlumedKernelHandle(const PlumedKernelHandle&);
+    PlumedKernelHandle& operator=(const PlumedKernelHandle&);
+#ifdef PLUMED_STATIC_KERNEL
+    // Arguments of the types PLUMED knows (numbers, strings, FILE) are type checked; others, such as MPI
+    // communicators, are passed as they are, like the C wrapper does.
+    template <class T>
+    static PLMD::TypesafePtr typesafe(T* value, std::size_t nelem, std::true_type) {
+        return PLMD::TypesafePtr(value, nelem);
+    }
+    template <class T>
+    static PLMD::TypesafePtr typesafe(T* value, std::size_t nelem, std::false_type) {
+        return PLMD::TypesafePtr::unchecked(value);
+    }
+    std::unique_ptr<PLMD::PlumedMain> main;
+#else
+    plumed main;
+#endif
+    bool created;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDKERNELHANDLE_H_*/
@@ -0,0 +1,78 @@
+#ifndef OPENMM_PLUMEDLOADBALANCEMONITOR_H_
+#define OPENMM_PLUMEDLOADBALANCEMONITOR_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include <mpi.h>
+#include "internal/windowsExportPlumed.h"
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace PlumedPlugin {
+
+/**
+ * This class produces the load balance report described in PlumedForce::setLoadBalanceReport().  A kernel creates
+ * one on the rank that holds the inter-replica communicator, and calls synchronize() at every new step before
+ * passing control to PLUMED.
+ */
+class OPENMM_EXPORT_PLUMED PlumedLoadBalanceMonitor {
+public:
+    /**
+     * Create a PlumedLoadBalanceMonitor.  This is collective over the communicator.
+     *
+     * @param comm       the communicator between replicas
+     * @param interval   the number of steps between summaries
+     * @param filename   the file the first replica writes the summaries to
+     */
+    PlumedLoadBalanceMonitor(MPI_Comm comm, int interval, const std::string& filename);
+    /**
+     * Wait for all replicas to reach this point, and write a summary if this completes an interval.
+     *
+     * @param step    the index of the step about to be computed
+     * @return the time in seconds spent waiting
+     */
+    double synchronize(int step);
+private:
+    void report(int step);
+    MPI_Comm comm;
+    int interval, rank, numReplicas;
+    std::ofstream out;
+    std::chrono::steady_clock::time_point lastEnd;
+    bool started;
+    std::vector<double> computeTimes, waitTimes;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDLOADBALANCEMONITOR_H_*/
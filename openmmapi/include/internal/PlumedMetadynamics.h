@@ -0,0 +1,113 @@
+#ifndef OPENMM_PLUMEDMETADYNAMICS_H_
+#define OPENMM_PLUMEDMETADYNAMICS_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "PlumedForce.h"
+#include "internal/windowsExportPlumed.h"
+#include "openmm/System.h"
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace PlumedPlugin {
+
+/**
+ * This class computes plain and well-tempered metadynamics without PLUMED, for the scripts described in
+ * PlumedForce::setUseNativeMetadynamics().  It follows PLUMED's definitions: hills are the stretched Gaussians of
+ * PLUMED (unless PLUMED_DP2CUTOFF_NOSTRETCH is set), a hill is deposited every PACE steps except at the first update,
+ * and with a GRID the bias is accumulated on a grid and interpolated with PLUMED's splines.  Hills are written to
+ * FILE (HILLS by default) in PLUMED's format.
+ *
+ * Without a grid the bias is a sum over all hills, which is laid out so that the compiler vectorizes it.
+ */
+class OPENMM_EXPORT_PLUMED PlumedMetadynamics {
+public:
+    /**
+     * Create a PlumedMetadynamics for a force, if its script is supported.  MPI must have been initialized.
+     *
+     * @param force      the force whose script to compute
+     * @param system     the System the force belongs to
+     * @param stepSize   the integration step size, in ps, to write the time of the hills
+     * @return the metadynamics, or a null pointer if the script or the settings of the force are not supported and
+     *         PLUMED must compute them
+     */
+    static std::unique_ptr<PlumedMetadynamics> create(const PlumedForce& force, const OpenMM::System& system, double stepSize);
+    ~PlumedMetadynamics();
+    /**
+     * Compute the bias and add the forces it applies.  If update is true, a hill is then deposited if this is a
+     * deposition step, and the values requested with PlumedForce::setCollectiveVariables() are recorded.
+     *
+     * @param positions   the positions of all particles (x, y and z of each one), in nm
+     * @param forces      the forces are added to this array, in the same layout, in kJ/mol/nm
+     * @param step        the index of the step
+     * @param update      whether this is the first calculation for a new step
+     * @return the bias energy in kJ/mol
+     */
+    double calcForcesAndEnergy(const double* positions, double* forces, int step, bool update);
+    /**
+     * Copy the values recorded at the most recent update, in the order given to PlumedForce::setCollectiveVariables().
+     */
+    void getRecordedValues(double* values) const;
+    /**
+     * Get the number of hills deposited so far.
+     */
+    int getNumHills() const;
+    /**
+     * Get the atoms the variables depend on, sorted by index.
+     */
+    std::vector<int> getAtoms() const;
+private:
+    struct Variable;
+    struct Grid;
+    PlumedMetadynamics();
+    double evaluateHills(const double* cv, double* derivatives);
+    double evaluateGrid(const double* cv, double* derivatives) const;
+    void addHill(const double* center, double hillHeight);
+    void writeHill(int step, const double* center, double hillHeight);
+    std::vector<Variable> variables;
+    std::vector<int> args, recordedIndices;
+    std::vector<double> values, sigma, invSigma, derivatives, recorded, scratch;
+    // Without a grid, the centers of the hills divided by the widths (one vector per argument) and the heights.
+    std::vector<std::vector<double> > scaledCenters;
+    std::vector<double> heights;
+    std::unique_ptr<Grid> grid;
+    double height, kT, biasFactor, stretchA, stretchB, stepSize;
+    int pace, numHills;
+    bool isFirstUpdate;
+    FILE* hillsFile;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDMETADYNAMICS_H_*/
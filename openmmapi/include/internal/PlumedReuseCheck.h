@@ -0,0 +1,106 @@
+#ifndef OPENMM_PLUMEDREUSECHECK_H_
+#define OPENMM_PLUMEDREUSECHECK_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/windowsExportPlumed.h"
+#include "openmm/Vec3.h"
+#include <string>
+#include <vector>
+
+namespace PlumedPlugin {
+
+/**
+ * This class decides whether a force computation may reuse the bias and forces PLUMED computed before (see
+ * PlumedForce::setReuseTolerance()).  It remembers the atoms used by the last computation by PLUMED, their
+ * positions, and the periodic box.  A later computation may reuse its results if it uses the same atoms, none of
+ * them moved farther than the tolerance, and the box is the same.
+ *
+ * Only the actions of a few static biases, variables and outputs are known to compute the same results at every
+ * step.  If the script has any other action, the bias may depend on the step or change when PLUMED is updated (as
+ * METAD does when it deposits a hill), so results are only reused within a step, and never after an update.
+ */
+class OPENMM_EXPORT_PLUMED PlumedReuseCheck {
+public:
+    /**
+     * Create a PlumedReuseCheck.
+     *
+     * @param tolerance    how far the atoms may move, in nm.  If it is 0, nothing is ever reused.
+     * @param script       the PLUMED script of the force
+     */
+    PlumedReuseCheck(double tolerance, const std::string& script);
+    /**
+     * Get whether reusing computations is enabled.
+     */
+    bool isEnabled() const {
+        return tolerance > 0;
+    }
+    /**
+     * Get whether every action in a script is known to compute the same bias at every step, whatever PLUMED was
+     * updated with before.
+     */
+    static bool isStatic(const std::string& script);
+    /**
+     * Get whether the results of the last computation by PLUMED may be reused.
+     *
+     * @param atoms        the atoms used by the actions active for this computation
+     * @param positions    the positions of all particles, of which those of the atoms must be valid
+     * @param box          the periodic box vectors, or NULL if the System is not periodic
+     * @param step         the step PLUMED computes
+     */
+    bool canReuse(const std::vector<int>& atoms, const OpenMM::Vec3* positions, const OpenMM::Vec3* box, int step) const;
+    /**
+     * Record the state of a computation by PLUMED, whose results may be reused later.
+     *
+     * @param atoms        the atoms used by the actions active for this computation
+     * @param positions    the positions of all particles, of which those of the atoms must be valid
+     * @param box          the periodic box vectors, or NULL if the System is not periodic
+     * @param step         the step PLUMED computes
+     */
+    void record(const std::vector<int>& atoms, const OpenMM::Vec3* positions, const OpenMM::Vec3* box, int step);
+    /**
+     * Tell the check that PLUMED was updated.  Unless the script is static, the results computed before can no
+     * longer be reused.
+     */
+    void updated();
+private:
+    double tolerance;
+    bool scriptIsStatic, hasRecord;
+    int step;
+    std::vector<int> atoms;
+    std::vector<OpenMM::Vec3> positions;
+    OpenMM::Vec3 box[3];
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDREUSECHECK_H_*/
@@ -0,0 +1,115 @@
+#ifndef OPENMM_PLUMEDSTEPSCHEDULE_H_
+#define OPENMM_PLUMEDSTEPSCHEDULE_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/windowsExportPlumed.h"
+#include "openmm/CustomIntegrator.h"
+#include "openmm/Integrator.h"
+
+namespace PlumedPlugin {
+
+/**
+ * This class decides which PLUMED step each force computation belongs to, and which computation of a step runs the
+ * update (depositing hills, writing output, and recording the values).
+ *
+ * Integrators like LangevinMiddleIntegrator compute the forces at the start of each step, on the positions of that
+ * step, so a computation belongs to the step of the Context and the first computation of a step does the update.
+ * Velocity Verlet CustomIntegrators, which include the multiple time step integrators MTSIntegrator and
+ * MTSLangevinIntegrator, instead compute the forces after moving the particles, and reuse them at the start of the
+ * next step.  A slow force group is then computed once per outer step, on the positions at the end of the step.
+ * For these integrators a computation made after the particles have moved belongs to the next step, and the update
+ * is done by the last such computation of the step, so it sees the final positions.  The forces PLUMED returns are
+ * never scaled: the integrator applies them with the time step of their group.
+ *
+ * Whether the particles have moved is not known to the plugin.  The number of computations after moving them is
+ * counted from the program of the integrator (blocks are counted as if they ran once).  A computation at the start
+ * of a step happens when the forces were invalidated, for example by a call to getState() for other force groups;
+ * the kernel recognizes it because the positions have not changed since the previous computation.  If a barostat
+ * or setPositions() changes the positions just before a step, that step's update is done on the new positions.
+ */
+class OPENMM_EXPORT_PLUMED PlumedStepSchedule {
+public:
+    /**
+     * Create a schedule for a force in a force group.
+     *
+     * @param integrator    the Integrator of the Context
+     * @param forceGroup    the force group of the PlumedForce
+     */
+    PlumedStepSchedule(const OpenMM::Integrator& integrator, int forceGroup);
+    /**
+     * Count how many times a step of a CustomIntegrator computes the forces of a group after moving the particles.
+     *
+     * @param integrator    the integrator whose program to analyze
+     * @param forceGroup    the force group
+     */
+    static int countComputationsAfterMoving(const OpenMM::CustomIntegrator& integrator, int forceGroup);
+    /**
+     * Get how many computations per step are made after moving the particles.  If this is 0, every computation
+     * belongs to the step of the Context.
+     */
+    int getComputationsAfterMoving() const {
+        return computationsAfterMoving;
+    }
+    /**
+     * Record that the integrator is starting a step.  This is called from updateContextState().
+     *
+     * @param stepCount     the step count of the Context
+     */
+    void beginStep(int stepCount);
+    /**
+     * Get whether the kernel must compare the positions with those of the previous computation before calling
+     * getStep().  This is the case for the first computation of a step when the integrator moves the particles
+     * before computing the forces.
+     *
+     * @param stepCount     the step count of the Context
+     */
+    bool needsPositionCheck(int stepCount) const;
+    /**
+     * Get the PLUMED step of a force computation.
+     *
+     * @param stepCount          the step count of the Context
+     * @param positionsChanged   whether the positions changed since the previous computation.  It is only used if
+     *                           needsPositionCheck() returned true.
+     * @param canUpdate          on exit, whether this computation may run the update.  The kernel still does it only
+     *                           if the step differs from that of its last update.
+     * @return the step to pass to PLUMED
+     */
+    int getStep(int stepCount, bool positionsChanged, bool& canUpdate);
+private:
+    int computationsAfterMoving, currentStep, numComputations, numAfterMoving;
+    bool inStep;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDSTEPSCHEDULE_H_*/
@@ -0,0 +1,71 @@
+#ifndef OPENMM_PLUMEDTHREADLIMIT_H_
+#define OPENMM_PLUMEDTHREADLIMIT_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/PlumedKernelHandle.h"
+#include "internal/windowsExportPlumed.h"
+
+namespace PlumedPlugin {
+
+/**
+ * This class runs PLUMED on a single OpenMP thread while a deterministic force computes (see
+ * PlumedForce::setDeterministic()).  PLUMED keeps the number of threads in one setting shared by every instance in
+ * the process, so it cannot simply be set once for a force.  Instead the setting is lowered to one thread when the
+ * first limit is created and restored to PLUMED's default (PLUMED_NUM_THREADS, or one thread) when the last one is
+ * destroyed.  Forces computing at the same time as a deterministic one therefore also run on one thread, but all
+ * other computations keep their threads.
+ */
+class OPENMM_EXPORT_PLUMED PlumedThreadLimit {
+public:
+    /**
+     * Create a PlumedThreadLimit, which lasts until it is destroyed.
+     *
+     * @param plumedmain    the PLUMED instance used to change the setting
+     * @param enabled       if false, the limit does nothing
+     */
+    PlumedThreadLimit(PlumedKernelHandle& plumedmain, bool enabled);
+    ~PlumedThreadLimit();
+    /**
+     * Get the number of threads PLUMED uses when no limit exists.
+     */
+    static int getDefaultNumThreads();
+private:
+    PlumedThreadLimit(const PlumedThreadLimit&);
+    PlumedThreadLimit& operator=(const PlumedThreadLimit&);
+    PlumedKernelHandle& plumedmain;
+    bool enabled;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDTHREADLIMIT_H_*/
@@ -0,0 +1,134 @@
+#ifndef OPENMM_PLUMEDTRACER_H_
+#define OPENMM_PLUMEDTRACER_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2014 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/windowsExportPlumed.h"
+#include <atomic>
+#include <string>
+
+namespace PlumedPlugin {
+
+/**
+ * This class records a timeline of what the plugin does, in the Chrome trace event format (it can be opened in
+ * chrome://tracing or https://ui.perfetto.dev).  Every thread gets its own track with a span for each phase of the
+ * calculation, and the GPU platforms add tracks with the times their copies and kernels ran on the device.
+ *
+ * Tracing is enabled by setting the environment variable OPENMM_PLUMED_TRACE to the name of the output file, which
+ * is written when the process exits.  If the process is part of an MPI job with more than one rank, the rank is
+ * appended to the file name.  It can also be started and stopped explicitly with start() and stop().  When tracing
+ * is disabled, recording a span costs a single test of a flag.
+ *
+ * Event names and categories must be string literals, or otherwise live until the trace is written.
+ */
+class OPENMM_EXPORT_PLUMED PlumedTracer {
+public:
+    /**
+     * Get whether events are being recorded.
+     */
+    static bool isEnabled() {
+        return enabled.load(std::memory_order_relaxed);
+    }
+    /**
+     * Start recording events, discarding any recorded before.
+     *
+     * @param path    the file the trace is written to by stop(), flush(), or when the process exits
+     */
+    static void start(const std::string& path);
+    /**
+     * Write the trace and stop recording events.
+     */
+    static void stop();
+    /**
+     * Write all events recorded so far.  This rewrites the whole file, so it can be called repeatedly.
+     */
+    static void flush();
+    /**
+     * Get the current time in nanoseconds on the clock used for all events.
+     */
+    static long long now();
+    /**
+     * Record a span on the track of the calling thread.
+     *
+     * @param name       the name of the span
+     * @param category   the category of the span
+     * @param start      the time the span began, as returned by now()
+     * @param end        the time the span ended, as returned by now()
+     */
+    static void addSpan(const char* name, const char* category, long long start, long long end);
+    /**
+     * Record a span on a device track, such as a CUDA stream.  The track is created the first time its name is used.
+     *
+     * @param name       the name of the span
+     * @param track      the name of the track
+     * @param start      the time the span began, on the clock of now()
+     * @param end        the time the span ended, on the clock of now()
+     */
+    static void addDeviceSpan(const char* name, const char* track, long long start, long long end);
+    /**
+     * Set the name of the track of the calling thread.
+     */
+    static void setThreadName(const char* name);
+private:
+    static std::atomic<bool> enabled;
+};
+
+/**
+ * This records a span on the track of the calling thread, from its construction to its destruction or to end().
+ */
+class PlumedTraceSpan {
+public:
+    PlumedTraceSpan(const char* name, const char* category="plugin") : name(name), category(category),
+            start(PlumedTracer::isEnabled() ? PlumedTracer::now() : -1) {
+    }
+    ~PlumedTraceSpan() {
+        end();
+    }
+    /**
+     * End the span before the object is destroyed.
+     */
+    void end() {
+        if (start >= 0)
+            PlumedTracer::addSpan(name, category, start, PlumedTracer::now());
+        start = -1;
+    }
+private:
+    PlumedTraceSpan(const PlumedTraceSpan&);
+    PlumedTraceSpan& operator=(const PlumedTraceSpan&);
+    const char* name;
+    const char* category;
+    long long start;
+};
+
+} // namespace PlumedPlugin
+
+#endif /*OPENMM_PLUMEDTRACER_H_*/
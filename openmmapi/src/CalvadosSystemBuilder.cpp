@@ -0,0 +1,223 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "CalvadosSystemBuilder.h"
+#include "openmm/CustomNonbondedForce.h"
+#include "openmm/HarmonicBondForce.h"
+#include "openmm/OpenMMException.h"
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+static vector<string> splitLine(const string& line) {
+    vector<string> fields;
+    stringstream stream(line);
+    string field;
+    while (getline(stream, field, ','))
+        fields.push_back(field);
+    return fields;
+}
+
+CalvadosSystemBuilder::CalvadosSystemBuilder() : numParticles(0), temperature(298.0), ionicStrength(0.2), pH(7.4), yukawaCutoff(4.0),
+        ashbaughHatchCutoff(2.0), bondLength(0.38), bondK(8033.0), periodic(false) {
+}
+
+void CalvadosSystemBuilder::setResidueType(char code, double mass, double charge, double sigma, double lambda) {
+    ResidueType& type = residueTypes[code];
+    type.mass = mass;
+    type.charge = charge;
+    type.sigma = sigma;
+    type.lambda = lambda;
+}
+
+void CalvadosSystemBuilder::loadResidueTable(const string& file, const string& lambdaColumn) {
+    ifstream input(file.c_str());
+    if (!input.is_open())
+        throw OpenMMException("CalvadosSystemBuilder: cannot open "+file);
+    string line;
+    getline(input, line);
+    vector<string> header = splitLine(line);
+    const string names[] = {"one", "MW", "q", "sigmas", lambdaColumn};
+    int columns[5];
+    for (int i = 0; i < 5; i++) {
+        columns[i] = -1;
+        for (int j = 0; j < header.size(); j++)
+            if (header[j] == names[i])
+                columns[i] = j;
+        if (columns[i] == -1)
+            throw OpenMMException("CalvadosSystemBuilder: "+file+" has no column "+names[i]);
+    }
+    while (getline(input, line)) {
+        if (line.empty() || line == "\r")
+            continue;
+        vector<string> fields = splitLine(line);
+        if (fields.size() < header.size() || fields[columns[0]].empty())
+            throw OpenMMException("CalvadosSystemBuilder: malformed line in "+file+": "+line);
+        setResidueType(fields[columns[0]][0], stod(fields[columns[1]]), stod(fields[columns[2]]), stod(fields[columns[3]]), stod(fields[columns[4]]));
+    }
+}
+
+int CalvadosSystemBuilder::addChain(const string& sequence) {
+    if (sequence.empty())
+        throw OpenMMException("CalvadosSystemBuilder: a chain must contain at least one residue");
+    int first = numParticles;
+    chains.push_back(sequence);
+    numParticles += sequence.size();
+    return first;
+}
+
+int CalvadosSystemBuilder::getNumChains() const {
+    return chains.size();
+}
+
+int CalvadosSystemBuilder::getNumParticles() const {
+    return numParticles;
+}
+
+void CalvadosSystemBuilder::setTemperature(double temperature) {
+    this->temperature = temperature;
+}
+
+void CalvadosSystemBuilder::setIonicStrength(double ionicStrength) {
+    this->ionicStrength = ionicStrength;
+}
+
+void CalvadosSystemBuilder::setPH(double pH) {
+    this->pH = pH;
+}
+
+void CalvadosSystemBuilder::setCutoffs(double yukawaCutoff, double ashbaughHatchCutoff) {
+    this->yukawaCutoff = yukawaCutoff;
+    this->ashbaughHatchCutoff = ashbaughHatchCutoff;
+}
+
+void CalvadosSystemBuilder::setBondParameters(double length, double k) {
+    bondLength = length;
+    bondK = k;
+}
+
+void CalvadosSystemBuilder::setPeriodicBoxVectors(const Vec3& a, const Vec3& b, const Vec3& c) {
+    periodic = true;
+    boxVectors[0] = a;
+    boxVectors[1] = b;
+    boxVectors[2] = c;
+}
+
+System* CalvadosSystemBuilder::createSystem() const {
+    // Compute the Debye-Huckel parameters for the temperature and ionic strength.
+
+    double RT = 8.3145*temperature*1e-3;
+    double T = temperature;
+    double epsw = 5321/T+233.76-0.9297*T+0.1417e-2*T*T-0.8292e-6*T*T*T;
+    double lB = 1.6021766*1.6021766/(4*M_PI*8.854188*epsw)*6.022*1000/RT;
+    double kappa = sqrt(8*M_PI*lB*ionicStrength*6.022/10);
+    double hisCharge = 1.0/(1.0+pow(10.0, pH-6));
+
+    // Create the forces.
+
+    System* system = new System();
+    if (periodic)
+        system->setDefaultPeriodicBoxVectors(boxVectors[0], boxVectors[1], boxVectors[2]);
+    CustomNonbondedForce::NonbondedMethod method = (periodic ? CustomNonbondedForce::CutoffPeriodic : CustomNonbondedForce::CutoffNonPeriodic);
+    HarmonicBondForce* bonds = new HarmonicBondForce();
+    CustomNonbondedForce* yukawa = new CustomNonbondedForce("RT*lB*epsilon1*epsilon2*(exp(-r*kappa)/r-exp(-r_cut*kappa)/r_cut)");
+    yukawa->addGlobalParameter("RT", RT);
+    yukawa->addGlobalParameter("lB", lB);
+    yukawa->addGlobalParameter("kappa", kappa);
+    yukawa->addGlobalParameter("r_cut", yukawaCutoff);
+    yukawa->addPerParticleParameter("epsilon");
+    yukawa->setNonbondedMethod(method);
+    yukawa->setCutoffDistance(yukawaCutoff);
+    CustomNonbondedForce* ashbaugh = new CustomNonbondedForce("c1*vlj+c2-shift;vlj=4*epsilon*((sigma/r)^12-(sigma/r)^6);"
+            "c1=select(delta(d),lambda,s1);c2=select(delta(d),0,s2);s1=select(step(d),lambda,1);s2=select(step(d),0,(1-lambda)*epsilon);"
+            "d=r-threshold*sigma;shift=lambda*vlj_shift;vlj_shift=4*epsilon*((sigma/rcut)^12-(sigma/rcut)^6);"
+            "lambda=0.5*(lambda1+lambda2);sigma=0.5*(sigma1+sigma2)");
+    ashbaugh->addGlobalParameter("epsilon", 4.184*0.2);
+    ashbaugh->addGlobalParameter("threshold", pow(2.0, 1.0/6.0));
+    ashbaugh->addGlobalParameter("rcut", ashbaughHatchCutoff);
+    ashbaugh->addPerParticleParameter("sigma");
+    ashbaugh->addPerParticleParameter("lambda");
+    ashbaugh->setNonbondedMethod(method);
+    ashbaugh->setCutoffDistance(ashbaughHatchCutoff);
+    ashbaugh->setForceGroup(1);
+    system->addForce(bonds);
+    system->addForce(yukawa);
+    system->addForce(ashbaugh);
+
+    // Add the particles.  The parameters of each residue are looked up once per chain position, and the per-particle
+    // parameter vectors are reused for every particle.
+
+    vector<pair<int, int> > bondPairs;
+    bondPairs.reserve(numParticles);
+    vector<double> yukawaParams(1), ashbaughParams(2);
+    for (const string& sequence : chains) {
+        int first = system->getNumParticles();
+        int length = sequence.size();
+        for (int i = 0; i < length; i++) {
+            map<char, ResidueType>::const_iterator type = residueTypes.find(sequence[i]);
+            if (type == residueTypes.end()) {
+                delete system;
+                throw OpenMMException(string("CalvadosSystemBuilder: unknown residue type ")+sequence[i]);
+            }
+            double mass = type->second.mass;
+            double charge = (sequence[i] == 'H' ? hisCharge : type->second.charge);
+            if (i == 0) {
+                mass += 2.0;
+                charge += 1.0;
+            }
+            if (i == length-1) {
+                mass += 16.0;
+                charge -= 1.0;
+            }
+            system->addParticle(mass);
+            yukawaParams[0] = charge;
+            yukawa->addParticle(yukawaParams);
+            ashbaughParams[0] = type->second.sigma;
+            ashbaughParams[1] = type->second.lambda;
+            ashbaugh->addParticle(ashbaughParams);
+            if (i > 0) {
+                bonds->addBond(first+i-1, first+i, bondLength, bondK);
+                bondPairs.push_back(make_pair(first+i-1, first+i));
+            }
+        }
+    }
+
+    // Exclude bonded pairs from the nonbonded interactions in a single pass per force.
+
+    yukawa->createExclusionsFromBonds(bondPairs, 1);
+    ashbaugh->createExclusionsFromBonds(bondPairs, 1);
+    return system;
+}
@@ -0,0 +1,196 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "ExclusionFile.h"
+#include "openmm/OpenMMException.h"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <set>
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+static const char magic[8] = {'O', 'M', 'M', 'P', 'E', 'X', 'C', 'L'};
+static const uint32_t formatVersion = 1;
+static const size_t headerSize = 24;
+
+/**
+ * The pairs are used where they are mapped, without conversion, so the host must store integers in the byte order
+ * of the format.
+ */
+static void checkByteOrder() {
+    const uint16_t one = 1;
+    if (*(const unsigned char*) &one != 1)
+        throw OpenMMException("ExclusionFile: exclusion files are little endian, which this host is not");
+}
+
+void ExclusionFile::write(const string& path, const vector<pair<int, int> >& pairs) {
+    checkByteOrder();
+    ofstream output(path.c_str(), ios::binary);
+    if (!output.is_open())
+        throw OpenMMException("ExclusionFile: cannot create "+path);
+    uint32_t version = formatVersion, reserved = 0;
+    uint64_t count = pairs.size();
+    output.write(magic, sizeof(magic));
+    output.write((const char*) &version, sizeof(version));
+    output.write((const char*) &reserved, sizeof(reserved));
+    output.write((const char*) &count, sizeof(count));
+    vector<int32_t> data(2*pairs.size());
+    for (size_t i = 0; i < pairs.size(); i++) {
+        data[2*i] = pairs[i].first;
+        data[2*i+1] = pairs[i].second;
+    }
+    if (!data.empty())
+        output.write((const char*) &data[0], data.size()*sizeof(int32_t));
+    if (!output.good())
+        throw OpenMMException("ExclusionFile: error writing "+path);
+}
+
+ExclusionFile::ExclusionFile(const string& path) : path(path), pairs(NULL), numPairs(0), mapping(NULL), mappingSize(0) {
+    checkByteOrder();
+    const char* data;
+    size_t size;
+#ifndef _WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw OpenMMException("ExclusionFile: cannot open "+path);
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        throw OpenMMException("ExclusionFile: cannot read "+path);
+    }
+    size = info.st_size;
+    if (size >= headerSize) {
+        mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            mapping = NULL;
+            close(fd);
+            throw OpenMMException("ExclusionFile: cannot map "+path);
+        }
+        mappingSize = size;
+        madvise(mapping, size, MADV_SEQUENTIAL);
+    }
+    close(fd);
+    data = (const char*) mapping;
+#else
+    ifstream input(path.c_str(), ios::binary|ios::ate);
+    if (!input.is_open())
+        throw OpenMMException("ExclusionFile: cannot open "+path);
+    size = input.tellg();
+    input.seekg(0);
+    buffer.resize((size+sizeof(int)-1)/sizeof(int));
+    if (size > 0)
+        input.read((char*) &buffer[0], size);
+    data = (const char*) &buffer[0];
+#endif
+    if (size < headerSize || memcmp(data, magic, sizeof(magic)) != 0) {
+        unmap();
+        throw OpenMMException("ExclusionFile: "+path+" is not an exclusion file");
+    }
+    uint32_t version;
+    uint64_t count;
+    memcpy(&version, data+8, sizeof(version));
+    memcpy(&count, data+16, sizeof(count));
+    // Compare the count with the number of pairs that fit in the file, which cannot overflow for a damaged header.
+
+    if (version != formatVersion || count > (size-headerSize)/(2*sizeof(int32_t))) {
+        unmap();
+        throw OpenMMException("ExclusionFile: "+path+" has an unsupported version or is truncated");
+    }
+    pairs = (const int*) (data+headerSize);
+    numPairs = count;
+}
+
+ExclusionFile::~ExclusionFile() {
+    unmap();
+}
+
+void ExclusionFile::unmap() {
+#ifndef _WIN32
+    if (mapping != NULL)
+        munmap(mapping, mappingSize);
+#endif
+    mapping = NULL;
+}
+
+long long ExclusionFile::getNumPairs() const {
+    return numPairs;
+}
+
+void ExclusionFile::getPair(long long index, int& particle1, int& particle2) const {
+    if (index < 0 || index >= numPairs)
+        throw OpenMMException("ExclusionFile: pair index out of range");
+    particle1 = pairs[2*index];
+    particle2 = pairs[2*index+1];
+}
+
+const int* ExclusionFile::getData() const {
+    return pairs;
+}
+
+int ExclusionFile::addExclusionsTo(CustomNonbondedForce& force) const {
+    // Check every pair before changing the force, so an invalid file leaves it as it was.
+
+    int numParticles = force.getNumParticles();
+    for (long long i = 0; i < numPairs; i++) {
+        int p1 = pairs[2*i], p2 = pairs[2*i+1];
+        if (p1 < 0 || p2 < 0 || p1 >= numParticles || p2 >= numParticles)
+            throw OpenMMException("ExclusionFile: "+path+" refers to a particle that is not in the force");
+        if (p1 == p2)
+            throw OpenMMException("ExclusionFile: "+path+" excludes a particle from itself");
+    }
+
+    // Record the exclusions the force already has, so the same pair is never added twice.
+
+    set<pair<int, int> > existing;
+    for (int i = 0; i < force.getNumExclusions(); i++) {
+        int p1, p2;
+        force.getExclusionParticles(i, p1, p2);
+        existing.insert(make_pair(min(p1, p2), max(p1, p2)));
+    }
+    int added = 0;
+    for (long long i = 0; i < numPairs; i++) {
+        int p1 = pairs[2*i], p2 = pairs[2*i+1];
+        if (existing.insert(make_pair(min(p1, p2), max(p1, p2))).second) {
+            force.addExclusion(p1, p2);
+            added++;
+        }
+    }
+    return added;
+}
@@ -0,0 +1,154 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "PlumedAsyncStepper.h"
+#include "openmm/Integrator.h"
+#include "openmm/OpenMMException.h"
+#include <algorithm>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+PlumedAsyncStepper::PlumedAsyncStepper(Context& context, const PlumedForce& force, int stride, int capacity) : context(context),
+        stride(stride), capacity(capacity), first(0), count(0), dropped(0), running(false) {
+    if (stride < 1)
+        throw OpenMMException("PlumedAsyncStepper: the stride must be at least 1");
+    if (capacity < 1)
+        throw OpenMMException("PlumedAsyncStepper: the capacity must be at least 1");
+    storage = force.getValueStorage(context);
+    snapshotSize = 2+storage->getNumValues();
+    ring.resize(capacity*snapshotSize);
+}
+
+PlumedAsyncStepper::~PlumedAsyncStepper() {
+    lock_guard<mutex> threadGuard(threadLock);
+    if (thread.joinable())
+        thread.join();
+}
+
+int PlumedAsyncStepper::getStride() const {
+    return stride;
+}
+
+int PlumedAsyncStepper::getCapacity() const {
+    return capacity;
+}
+
+int PlumedAsyncStepper::getSnapshotSize() const {
+    return snapshotSize;
+}
+
+void PlumedAsyncStepper::start(int steps) {
+    // threadLock serializes start() and wait(), which may be called from different threads.
+
+    lock_guard<mutex> threadGuard(threadLock);
+    {
+        lock_guard<mutex> guard(lock);
+        if (running)
+            throw OpenMMException("PlumedAsyncStepper: the previous run has not finished");
+    }
+    if (thread.joinable())
+        thread.join();
+    lock_guard<mutex> guard(lock);
+    error = nullptr;
+    running = true;
+    thread = std::thread(&PlumedAsyncStepper::run, this, steps);
+}
+
+bool PlumedAsyncStepper::isRunning() const {
+    lock_guard<mutex> guard(lock);
+    return running;
+}
+
+void PlumedAsyncStepper::wait() {
+    exception_ptr failure;
+    {
+        lock_guard<mutex> threadGuard(threadLock);
+        if (thread.joinable())
+            thread.join();
+        lock_guard<mutex> guard(lock);
+        swap(failure, error);
+    }
+    if (failure)
+        rethrow_exception(failure);
+}
+
+int PlumedAsyncStepper::readSnapshots(vector<double>& snapshots) {
+    lock_guard<mutex> guard(lock);
+    int numRead = count;
+    for (; count > 0; count--) {
+        const double* snapshot = &ring[first*snapshotSize];
+        snapshots.insert(snapshots.end(), snapshot, snapshot+snapshotSize);
+        first = (first+1)%capacity;
+    }
+    return numRead;
+}
+
+long long PlumedAsyncStepper::getNumDropped() const {
+    lock_guard<mutex> guard(lock);
+    return dropped;
+}
+
+void PlumedAsyncStepper::run(int steps) {
+    try {
+        Integrator& integrator = context.getIntegrator();
+        for (int done = 0; done < steps; ) {
+            int chunk = min(stride, steps-done);
+            integrator.step(chunk);
+            done += chunk;
+            if (chunk == stride)
+                record();
+        }
+    }
+    catch (...) {
+        lock_guard<mutex> guard(lock);
+        error = current_exception();
+    }
+    lock_guard<mutex> guard(lock);
+    running = false;
+}
+
+void PlumedAsyncStepper::record() {
+    // The values were computed by PLUMED at the last step taken, i.e. one before the current step count.
+
+    lock_guard<mutex> guard(lock);
+    if (count == capacity) {
+        first = (first+1)%capacity;
+        count--;
+        dropped++;
+    }
+    double* snapshot = &ring[((first+count)%capacity)*snapshotSize];
+    snapshot[0] = (double) (context.getStepCount()-1);
+    snapshot[1] = storage->getBias();
+    copy(storage->getValues(), storage->getValues()+storage->getNumValues(), snapshot+2);
+    count++;
+}
@@ -0,0 +1,426 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/PlumedContactVariables.h"
+#include "openmm/OpenMMException.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <sstream>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+/**
+ * Split a line of the script into its label, its action and its keywords, keeping the contents of braces together.
+ * Flags are stored as keywords with an empty value.  Return false if the line uses syntax that is not supported here.
+ */
+static bool parseLine(const string& line, string& label, string& action, map<string, string>& keywords) {
+    vector<string> words;
+    string word;
+    int depth = 0;
+    for (char c : line) {
+        if (c == '{')
+            depth++;
+        else if (c == '}')
+            depth--;
+        if ((c == ' ' || c == '\t') && depth == 0) {
+            if (!word.empty())
+                words.push_back(word);
+            word.clear();
+        }
+        else if (c != '{' && c != '}')
+            word += c;
+        if (depth < 0)
+            return false;
+    }
+    if (depth != 0)
+        return false;
+    if (!word.empty())
+        words.push_back(word);
+    label = "";
+    action = "";
+    keywords.clear();
+    for (const string& w : words) {
+        if (action == "" && label == "" && w.size() > 1 && w.back() == ':')
+            label = w.substr(0, w.size()-1);
+        else if (action == "")
+            action = w;
+        else {
+            size_t equals = w.find('=');
+            string key = w.substr(0, equals);
+            string value = (equals == string::npos ? "" : w.substr(equals+1));
+            if (key == "LABEL" && label == "")
+                label = value;
+            else if (key == "LABEL" || keywords.find(key) != keywords.end())
+                return false;
+            else
+                keywords[key] = value;
+        }
+    }
+    return true;
+}
+
+static bool parseNumber(const string& text, double& value) {
+    char* end;
+    value = strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0';
+}
+
+/**
+ * Parse a list of atoms made of indices and ranges (e.g. 1-10,12), converting them to zero based indices.
+ */
+static bool parseAtoms(const string& text, int numParticles, vector<int>& atoms) {
+    atoms.clear();
+    stringstream stream(text);
+    string item;
+    while (getline(stream, item, ',')) {
+        size_t dash = item.find('-', 1);
+        double first, last;
+        if (dash == string::npos) {
+            if (!parseNumber(item, first))
+                return false;
+            last = first;
+        }
+        else if (!parseNumber(item.substr(0, dash), first) || !parseNumber(item.substr(dash+1), last))
+            return false;
+        if (first != floor(first) || last != floor(last) || first < 1 || last > numParticles || last < first)
+            return false;
+        for (int i = (int) first; i <= (int) last; i++)
+            atoms.push_back(i-1);
+    }
+    return atoms.size() > 0;
+}
+
+/**
+ * Stretch a switching function so that it goes from 1 at zero distance to 0 at D_MAX, as PLUMED does.
+ */
+static void stretchSwitch(double* parameters) {
+    double dfunc;
+    parameters[PlumedContactVariables::Stretch] = 1.0;
+    parameters[PlumedContactVariables::Shift] = 0.0;
+    parameters[PlumedContactVariables::Weight] = 1.0;
+    double s0 = PlumedContactVariables::evaluateSwitch(parameters, 0.0, dfunc);
+    double sMax = PlumedContactVariables::evaluateSwitch(parameters, parameters[PlumedContactVariables::DMax], dfunc);
+    parameters[PlumedContactVariables::Stretch] = 1.0/(s0-sMax);
+    parameters[PlumedContactVariables::Shift] = -sMax/(s0-sMax);
+}
+
+/**
+ * Set the parameters of a rational switching function from R_0, D_0, NN and MM.  As PLUMED does for these keywords,
+ * the function is cut off where it falls below 1e-5 and stretched.
+ */
+static bool setLegacySwitch(map<string, string>& keywords, double* parameters) {
+    double r0, d0 = 0.0, nn = 6, mm = 0;
+    if (keywords.count("R_0") == 0 || !parseNumber(keywords["R_0"], r0) || !(r0 > 0))
+        return false;
+    if ((keywords.count("D_0") != 0 && !parseNumber(keywords["D_0"], d0)) || (keywords.count("NN") != 0 && !parseNumber(keywords["NN"], nn)) ||
+            (keywords.count("MM") != 0 && !parseNumber(keywords["MM"], mm)))
+        return false;
+    if (mm == 0)
+        mm = 2*nn;
+    if (nn != floor(nn) || mm != floor(mm) || nn < 1 || mm < 1 || nn == mm)
+        return false;
+    parameters[PlumedContactVariables::InvR0] = 1.0/r0;
+    parameters[PlumedContactVariables::D0] = d0;
+    parameters[PlumedContactVariables::NN] = nn;
+    parameters[PlumedContactVariables::MM] = mm;
+    parameters[PlumedContactVariables::DMax] = d0+r0*pow(0.00001, 1.0/(nn-mm));
+    stretchSwitch(parameters);
+    return true;
+}
+
+/**
+ * Set the parameters of a switching function from the contents of a SWITCH keyword.  Only RATIONAL is supported.
+ */
+static bool setSwitch(const string& definition, double* parameters) {
+    string label, action;
+    map<string, string> keywords;
+    if (!parseLine(definition, label, action, keywords) || label != "" || action != "RATIONAL")
+        return false;
+    bool stretch = (keywords.erase("NOSTRETCH") == 0);
+    double dmax = numeric_limits<double>::max();
+    if (keywords.count("D_MAX") != 0 && !parseNumber(keywords["D_MAX"], dmax))
+        return false;
+    bool hasMax = (keywords.erase("D_MAX") == 1);
+    for (auto& keyword : keywords)
+        if (keyword.first != "R_0" && keyword.first != "D_0" && keyword.first != "NN" && keyword.first != "MM")
+            return false;
+    if (!setLegacySwitch(keywords, parameters))
+        return false;
+    parameters[PlumedContactVariables::DMax] = dmax;
+    parameters[PlumedContactVariables::Stretch] = 1.0;
+    parameters[PlumedContactVariables::Shift] = 0.0;
+    if (hasMax && stretch)
+        stretchSwitch(parameters);
+    return true;
+}
+
+PlumedContactVariables::PlumedContactVariables() {
+    variableStart.push_back(0);
+}
+
+unique_ptr<PlumedContactVariables> PlumedContactVariables::create(const PlumedForce& force, const System& system) {
+    if (!force.getUseDeviceContactVariables())
+        return nullptr;
+    unique_ptr<PlumedContactVariables> variables(new PlumedContactVariables());
+    stringstream input(force.getScript()), output;
+    string line;
+    bool continued = false, ended = false;
+    while (getline(input, line)) {
+        // Lines after ENDPLUMED and directives continued over several lines are left to PLUMED.
+
+        string content = line.substr(0, line.find('#'));
+        bool continuation = (content.find("...") != string::npos);
+        if (continued || continuation || ended) {
+            if (continuation)
+                continued = !continued;
+            output << line << '\n';
+            continue;
+        }
+        string label, action;
+        map<string, string> keywords;
+        bool parsed = parseLine(content, label, action, keywords);
+        if (action == "ENDPLUMED")
+            ended = true;
+        bool noPBC = (keywords.erase("NOPBC") == 1);
+        keywords.erase("SERIAL");
+        bool periodic = system.usesPeriodicBoundaryConditions();
+        vector<int> pairs;
+        vector<double> parameters;
+        bool supported = parsed && label != "" && !(noPBC && periodic);
+        if (supported && action == "COORDINATION") {
+            vector<int> groupA, groupB;
+            double switchParameters[NumParameters] = {0};
+            for (auto& keyword : keywords)
+                if (keyword.first != "GROUPA" && keyword.first != "GROUPB" && keyword.first != "SWITCH" && keyword.first != "R_0" &&
+                        keyword.first != "D_0" && keyword.first != "NN" && keyword.first != "MM")
+                    supported = false;
+            supported &= parseAtoms(keywords["GROUPA"], system.getNumParticles(), groupA);
+            if (keywords.count("GROUPB") != 0)
+                supported &= parseAtoms(keywords["GROUPB"], system.getNumParticles(), groupB);
+            if (keywords.count("SWITCH") != 0)
+                supported &= (keywords.count("R_0") == 0 && setSwitch(keywords["SWITCH"], switchParameters));
+            else
+                supported &= setLegacySwitch(keywords, switchParameters);
+            switchParameters[Weight] = 1.0;
+            switchParameters[Periodic] = (periodic ? 1.0 : 0.0);
+            if (supported) {
+                // With a single group every pair is counted once; with two, pairs of an atom with itself are skipped.
+
+                for (int i = 0; i < groupA.size(); i++) {
+                    if (groupB.size() == 0) {
+                        for (int j = i+1; j < groupA.size(); j++)
+                            if (groupA[i] != groupA[j])
+                                pairs.insert(pairs.end(), {groupA[i], groupA[j]});
+                    }
+                    else {
+                        for (int j : groupB)
+                            if (groupA[i] != j)
+                                pairs.insert(pairs.end(), {groupA[i], j});
+                    }
+                }
+                for (int i = 0; i < pairs.size()/2; i++)
+                    parameters.insert(parameters.end(), switchParameters, switchParameters+NumParameters);
+            }
+        }
+        else if (supported && action == "CONTACTMAP") {
+            supported = (keywords.erase("SUM") == 1);
+            for (int i = 1; supported && keywords.count("ATOMS"+to_string(i)) != 0; i++) {
+                string index = to_string(i);
+                vector<int> atoms;
+                double switchParameters[NumParameters] = {0};
+                supported &= (parseAtoms(keywords["ATOMS"+index], system.getNumParticles(), atoms) && atoms.size() == 2);
+                string definition = (keywords.count("SWITCH"+index) != 0 ? keywords["SWITCH"+index] : keywords["SWITCH"]);
+                supported &= setSwitch(definition, switchParameters);
+                switchParameters[Weight] = 1.0;
+                if (keywords.count("WEIGHT"+index) != 0)
+                    supported &= parseNumber(keywords["WEIGHT"+index], switchParameters[Weight]);
+                switchParameters[Periodic] = (periodic ? 1.0 : 0.0);
+                keywords.erase("ATOMS"+index);
+                keywords.erase("SWITCH"+index);
+                keywords.erase("WEIGHT"+index);
+                if (supported) {
+                    pairs.insert(pairs.end(), atoms.begin(), atoms.end());
+                    parameters.insert(parameters.end(), switchParameters, switchParameters+NumParameters);
+                }
+            }
+            keywords.erase("SWITCH");
+            supported &= (keywords.size() == 0 && pairs.size() > 0);
+        }
+        else
+            supported = false;
+        if (!supported) {
+            output << line << '\n';
+            continue;
+        }
+        output << label << ": EXTRACV NAME=" << label << '\n';
+        variables->names.push_back(label);
+        variables->pairAtoms.insert(variables->pairAtoms.end(), pairs.begin(), pairs.end());
+        variables->pairParameters.insert(variables->pairParameters.end(), parameters.begin(), parameters.end());
+        variables->variableStart.push_back(variables->pairAtoms.size()/2);
+    }
+    if (variables->names.size() == 0)
+        return nullptr;
+    variables->script = output.str();
+    variables->pairDerivatives.resize(variables->pairAtoms.size()/2*3);
+    return variables;
+}
+
+const string& PlumedContactVariables::getScript() const {
+    return script;
+}
+
+int PlumedContactVariables::getNumVariables() const {
+    return names.size();
+}
+
+const string& PlumedContactVariables::getVariableName(int index) const {
+    return names[index];
+}
+
+const vector<int>& PlumedContactVariables::getVariableStart() const {
+    return variableStart;
+}
+
+const vector<int>& PlumedContactVariables::getPairAtoms() const {
+    return pairAtoms;
+}
+
+const vector<double>& PlumedContactVariables::getPairParameters() const {
+    return pairParameters;
+}
+
+void PlumedContactVariables::getAtomPairs(vector<int>& atoms, vector<int>& start, vector<int>& entries) const {
+    map<int, vector<int> > atomEntries;
+    for (int i = 0; i < pairAtoms.size(); i++)
+        atomEntries[pairAtoms[i]].push_back(i);
+    atoms.clear();
+    start.assign(1, 0);
+    entries.clear();
+    for (auto& atom : atomEntries) {
+        atoms.push_back(atom.first);
+        entries.insert(entries.end(), atom.second.begin(), atom.second.end());
+        start.push_back(entries.size());
+    }
+}
+
+double PlumedContactVariables::evaluateSwitch(const double* parameters, double r, double& dfunc) {
+    // This is PLUMED's rational switching function, (1-x^NN)/(1-x^MM) with x = (r-D_0)/R_0.
+
+    dfunc = 0.0;
+    if (r > parameters[DMax])
+        return 0.0;
+    double x = (r-parameters[D0])*parameters[InvR0];
+    double value = 1.0;
+    if (x > 0.0) {
+        double nn = parameters[NN], mm = parameters[MM];
+        if (fabs(x-1.0) < 100*numeric_limits<double>::epsilon()) {
+            value = nn/mm;
+            dfunc = 0.5*nn*(nn-mm)/mm;
+        }
+        else {
+            double xn = pow(x, nn-1), xm = pow(x, mm-1);
+            double numerator = 1.0-xn*x, denominator = 1.0-xm*x;
+            value = numerator/denominator;
+            dfunc = (-nn*xn*denominator+mm*xm*numerator)/(denominator*denominator);
+        }
+        dfunc *= parameters[InvR0];
+    }
+    value = value*parameters[Stretch]+parameters[Shift];
+    dfunc *= parameters[Stretch];
+    if (r > 0.0)
+        dfunc /= r;
+    dfunc *= parameters[Weight];
+    return value*parameters[Weight];
+}
+
+void PlumedContactVariables::computeValues(const double* positions, const double* boxVectors, double* values) {
+    bool triclinic = (boxVectors != NULL && (boxVectors[3] != 0.0 || boxVectors[6] != 0.0 || boxVectors[7] != 0.0));
+    for (int variable = 0; variable < names.size(); variable++) {
+        double sum = 0.0;
+        for (int pair = variableStart[variable]; pair < variableStart[variable+1]; pair++) {
+            const double* parameters = &pairParameters[pair*NumParameters];
+            const double* p1 = &positions[3*pairAtoms[2*pair]];
+            const double* p2 = &positions[3*pairAtoms[2*pair+1]];
+            double delta[3] = {p2[0]-p1[0], p2[1]-p1[1], p2[2]-p1[2]};
+            if (boxVectors != NULL && parameters[Periodic] != 0.0) {
+                // Reduce the offset as OpenMM does.  In a triclinic box this is not always the nearest image, so
+                // the neighboring images are searched as PLUMED does.
+
+                for (int i = 2; i >= 0; i--) {
+                    double scale = floor(delta[i]/boxVectors[3*i+i]+0.5);
+                    for (int j = 0; j < 3; j++)
+                        delta[j] -= scale*boxVectors[3*i+j];
+                }
+                if (triclinic) {
+                    double best[3] = {delta[0], delta[1], delta[2]};
+                    double bestR2 = delta[0]*delta[0]+delta[1]*delta[1]+delta[2]*delta[2];
+                    for (int i = -1; i <= 1; i++)
+                        for (int j = -1; j <= 1; j++)
+                            for (int k = -1; k <= 1; k++) {
+                                double image[3], r2 = 0.0;
+                                for (int m = 0; m < 3; m++) {
+                                    image[m] = delta[m]+i*boxVectors[m]+j*boxVectors[3+m]+k*boxVectors[6+m];
+                                    r2 += image[m]*image[m];
+                                }
+                                if (r2 < bestR2) {
+                                    bestR2 = r2;
+                                    copy(image, image+3, best);
+                                }
+                            }
+                    copy(best, best+3, delta);
+                }
+            }
+            double r = sqrt(delta[0]*delta[0]+delta[1]*delta[1]+delta[2]*delta[2]);
+            double dfunc;
+            sum += evaluateSwitch(parameters, r, dfunc);
+            for (int i = 0; i < 3; i++)
+                pairDerivatives[3*pair+i] = dfunc*delta[i];
+        }
+        values[variable] = sum;
+    }
+}
+
+void PlumedContactVariables::addForces(const double* variableForces, double* forces) const {
+    for (int variable = 0; variable < names.size(); variable++)
+        for (int pair = variableStart[variable]; pair < variableStart[variable+1]; pair++) {
+            int atom1 = pairAtoms[2*pair], atom2 = pairAtoms[2*pair+1];
+            for (int i = 0; i < 3; i++) {
+                double f = variableForces[variable]*pairDerivatives[3*pair+i];
+                forces[3*atom2+i] += f;
+                forces[3*atom1+i] -= f;
+            }
+        }
+}
@@ -0,0 +1,151 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/PlumedCoordinateExport.h"
+#include "openmm/System.h"
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+struct PlumedCoordinateExport::Client {
+    bool active, allAtoms;
+    vector<int> atoms;
+};
+
+shared_ptr<PlumedCoordinateExport> PlumedCoordinateExport::acquire(const ContextImpl& context) {
+    static mutex lock;
+    static map<const ContextImpl*, weak_ptr<PlumedCoordinateExport> > exports;
+    lock_guard<mutex> guard(lock);
+    for (auto iter = exports.begin(); iter != exports.end(); )
+        if (iter->second.expired())
+            iter = exports.erase(iter);
+        else
+            ++iter;
+    shared_ptr<PlumedCoordinateExport> result = exports[&context].lock();
+    if (!result) {
+        result.reset(new PlumedCoordinateExport(context.getSystem().getNumParticles()));
+        exports[&context] = result;
+    }
+    return result;
+}
+
+PlumedCoordinateExport::PlumedCoordinateExport(int numParticles) : positions(numParticles), isTransferred(numParticles, 0),
+        allTransferred(false), hasComputation(false), computation(0) {
+}
+
+int PlumedCoordinateExport::addClient() {
+    Client client;
+    client.active = true;
+    client.allAtoms = false;
+    clients.push_back(client);
+    return clients.size()-1;
+}
+
+void PlumedCoordinateExport::removeClient(int client) {
+    clients[client].active = false;
+    clients[client].atoms.clear();
+}
+
+const vector<Vec3>& PlumedCoordinateExport::getPositions(int client, int computation, const vector<int>& atoms, bool allAtoms, const Transfer& transfer) {
+    missingAtoms.clear();
+    if (!hasComputation || computation != this->computation) {
+        // This is the first request of a new computation, so the previous positions are all stale.  Transfer the
+        // atoms every kernel needed last time, expecting they will be needed again, along with the requested ones.
+
+        hasComputation = true;
+        this->computation = computation;
+        for (int atom : transferredAtoms)
+            isTransferred[atom] = 0;
+        transferredAtoms.clear();
+        allTransferred = false;
+        bool transferAll = allAtoms;
+        for (const Client& c : clients)
+            transferAll |= (c.active && c.allAtoms);
+        if (!transferAll) {
+            for (int atom : atoms)
+                missingAtoms.push_back(atom);
+            for (const Client& c : clients)
+                if (c.active)
+                    for (int atom : c.atoms)
+                        missingAtoms.push_back(atom);
+            sort(missingAtoms.begin(), missingAtoms.end());
+            missingAtoms.erase(unique(missingAtoms.begin(), missingAtoms.end()), missingAtoms.end());
+        }
+        transferMissing(transferAll, true, transfer);
+    }
+    else if (!allTransferred) {
+        // Other kernels have already requested positions during this computation.  Transfer only what they did
+        // not need, without touching the positions their worker threads may be reading.
+
+        if (!allAtoms)
+            for (int atom : atoms)
+                if (!isTransferred[atom])
+                    missingAtoms.push_back(atom);
+        if (allAtoms || missingAtoms.size() > 0)
+            transferMissing(allAtoms, false, transfer);
+    }
+    clients[client].allAtoms = allAtoms;
+    if (allAtoms)
+        clients[client].atoms.clear();
+    else
+        clients[client].atoms = atoms;
+    return positions;
+}
+
+void PlumedCoordinateExport::transferMissing(bool allAtoms, bool inPlace, const Transfer& transfer) {
+    if (inPlace) {
+        if (allAtoms || missingAtoms.size() > 0)
+            transfer(missingAtoms, allAtoms, positions);
+    }
+    else {
+        scratch.resize(positions.size());
+        transfer(missingAtoms, allAtoms, scratch);
+        if (allAtoms) {
+            for (int i = 0; i < positions.size(); i++)
+                if (!isTransferred[i])
+                    positions[i] = scratch[i];
+        }
+        else
+            for (int atom : missingAtoms)
+                positions[atom] = scratch[atom];
+    }
+    if (allAtoms)
+        allTransferred = true;
+    else
+        for (int atom : missingAtoms) {
+            isTransferred[atom] = 1;
+            transferredAtoms.push_back(atom);
+        }
+}
@@ -30,16 +30,20 @@
  * -------------------------------------------------------------------------- */
 
 #include <mpi.h>
+#include "openmm/HarmonicBondForce.h"
 #include "openmm/OpenMMException.h"
+#include "openmm/System.h"
 #include "PlumedForce.h"
 #include "internal/PlumedForceImpl.h"
+#include <cmath>
 
 using namespace PlumedPlugin;
 using namespace OpenMM;
 using namespace std;
 
 PlumedForce::PlumedForce(const string& script, const MPI_Comm intra_comm, const MPI_Comm inter_comm) : script(script), temperature(-1),
-    logStream(stdout), restart(false), intra_comm(intra_comm), inter_comm(inter_comm) {
+    masses(make_shared<vector<double> >()), logStream(stdout, [] (FILE*) {}), restart(false), intra_comm(intra_comm), inter_comm(inter_comm), loadBalanceInterval(0), useHardwareCounters(false), deterministic(false),
+    useNativeMetadynamics(false), useDeviceContactVariables(false), reuseTolerance(0.0) {
 }
 
 const string& PlumedForce::getScript() const {
@@ -63,22 +67,83 @@ double PlumedForce::getTemperature() const {
 }
 
 void PlumedForce::setMasses(const std::vector<double>& masses_) {
-    masses = masses_;
+    masses = make_shared<vector<double> >(masses_);
 }
 
 const std::vector<double>& PlumedForce::getMasses() const {
+    return *masses;
+}
+
+shared_ptr<const vector<double> > PlumedForce::getSharedMasses() const {
     return masses;
 }
 
-void PlumedForce::setLogStream(FILE* stream) {
+void PlumedForce::setMassesFromTopologyRepartitioning(const OpenMM::System& system, double hmass) {
+    const double hydrogenMass = 1.007947;
+    if (hmass <= 0)
+        throw OpenMMException("PlumedForce::setMassesFromTopologyRepartitioning: the hydrogen mass must be positive");
+    int numParticles = system.getNumParticles();
+    shared_ptr<vector<double> > physical = make_shared<vector<double> >(numParticles);
+    vector<char> isHydrogen(numParticles);
+    for (int i = 0; i < numParticles; i++) {
+        (*physical)[i] = system.getParticleMass(i);
+        isHydrogen[i] = (fabs((*physical)[i]-hmass) < 1e-6*hmass);
+    }
+
+    // Find the heavy particle each hydrogen is attached to, looking at the constraints first and then the bonds.
+    // The partner is recognized by its mass differing from hmass, not by being heavier: a heavy atom can be
+    // lighter than its hydrogens after repartitioning, e.g. a methyl carbon at hmass=4.
+
+    vector<int> partner(numParticles, -1);
+    auto connect = [&] (int p1, int p2) {
+        if (isHydrogen[p1] && !isHydrogen[p2] && partner[p1] == -1)
+            partner[p1] = p2;
+        if (isHydrogen[p2] && !isHydrogen[p1] && partner[p2] == -1)
+            partner[p2] = p1;
+    };
+    for (int i = 0; i < system.getNumConstraints(); i++) {
+        int p1, p2;
+        double distance;
+        system.getConstraintParameters(i, p1, p2, distance);
+        connect(p1, p2);
+    }
+    for (int j = 0; j < system.getNumForces(); j++) {
+        const HarmonicBondForce* bonds = dynamic_cast<const HarmonicBondForce*>(&system.getForce(j));
+        if (bonds != NULL)
+            for (int i = 0; i < bonds->getNumBonds(); i++) {
+                int p1, p2;
+                double length, k;
+                bonds->getBondParameters(i, p1, p2, length, k);
+                connect(p1, p2);
+            }
+    }
+
+    // Move the repartitioned mass back from each hydrogen to its partner.
+
+    for (int i = 0; i < numParticles; i++)
+        if (partner[i] != -1) {
+            (*physical)[i] = hydrogenMass;
+            (*physical)[partner[i]] += hmass-hydrogenMass;
+        }
+    masses = physical;
+}
+
+void PlumedForce::setLogStream(FILE* stream, bool close) {
 
     if (!stream)
         throw OpenMMException("PlumedForce::setLogStream: the stream has to be open");
 
-    logStream = stream;
+    if (close)
+        logStream = shared_ptr<FILE>(stream, fclose);
+    else
+        logStream = shared_ptr<FILE>(stream, [] (FILE*) {});
 }
 
 FILE* PlumedForce::getLogStream() const {
+    return logStream.get();
+}
+
+shared_ptr<FILE> PlumedForce::getSharedLogStream() const {
     return logStream;
 }
 
@@ -92,4 +157,81 @@ void PlumedForce::setRestart(bool restart_) {
 
 bool PlumedForce::getRestart() const {
     return restart;
-}
\ No newline at end of file
+}
+
+void PlumedForce::setCollectiveVariables(const std::vector<std::string>& labels) {
+    collectiveVariables = labels;
+}
+
+const std::vector<std::string>& PlumedForce::getCollectiveVariables() const {
+    return collectiveVariables;
+}
+
+void PlumedForce::setLoadBalanceReport(int interval, const string& filename) {
+    if (interval < 0)
+        throw OpenMMException("PlumedForce::setLoadBalanceReport: the interval cannot be negative");
+    loadBalanceInterval = interval;
+    loadBalanceFile = filename;
+}
+
+int PlumedForce::getLoadBalanceReportInterval() const {
+    return loadBalanceInterval;
+}
+
+const string& PlumedForce::getLoadBalanceReportFile() const {
+    return loadBalanceFile;
+}
+
+void PlumedForce::setUseHardwareCounters(bool use) {
+    useHardwareCounters = use;
+}
+
+bool PlumedForce::getUseHardwareCounters() const {
+    return useHardwareCounters;
+}
+
+void PlumedForce::setDeterministic(bool deterministic) {
+    this->deterministic = deterministic;
+}
+
+bool PlumedForce::getDeterministic() const {
+    return deterministic;
+}
+
+void PlumedForce::setUseNativeMetadynamics(bool use) {
+    useNativeMetadynamics = use;
+}
+
+bool PlumedForce::getUseNativeMetadynamics() const {
+    return useNativeMetadynamics;
+}
+
+void PlumedForce::setUseDeviceContactVariables(bool use) {
+    useDeviceContactVariables = use;
+}
+
+bool PlumedForce::getUseDeviceContactVariables() const {
+    return useDeviceContactVariables;
+}
+
+void PlumedForce::setReuseTolerance(double tolerance) {
+    if (tolerance < 0)
+        throw OpenMMException("PlumedForce::setReuseTolerance: the tolerance cannot be negative");
+    reuseTolerance = tolerance;
+}
+
+double PlumedForce::getReuseTolerance() const {
+    return reuseTolerance;
+}
+
+void PlumedForce::getCollectiveVariableValues(const Context& context, std::vector<double>& values) const {
+    dynamic_cast<const PlumedForceImpl&>(getImplInContext(context)).getCollectiveVariableValues(values);
+}
+
+double PlumedForce::getBiasEnergy(const Context& context) const {
+    return dynamic_cast<const PlumedForceImpl&>(getImplInContext(context)).getBiasEnergy();
+}
+
+std::shared_ptr<PlumedValueStorage> PlumedForce::getValueStorage(const Context& context) const {
+    return dynamic_cast<const PlumedForceImpl&>(getImplInContext(context)).getValueStorage();
+}
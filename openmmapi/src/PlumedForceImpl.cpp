@@ -31,7 +31,10 @@
 
 #include "internal/PlumedForceImpl.h"
 #include "PlumedKernels.h"
+#include "openmm/NonbondedForce.h"
+#include "openmm/OpenMMException.h"
 #include "openmm/internal/ContextImpl.h"
+#include <iostream>
 
 using namespace PlumedPlugin;
 using namespace OpenMM;
@@ -48,6 +51,12 @@ void PlumedForceImpl::initialize(ContextImpl& context) {
     kernel.getAs<CalcPlumedForceKernel>().initialize(context.getSystem(), owner);
 }
 
+void PlumedForceImpl::updateContextState(ContextImpl& context, bool& forcesInvalid) {
+    // This force field doesn't update the state directly, but the kernel needs to know when each step starts.
+
+    kernel.getAs<CalcPlumedForceKernel>().beginStep(context);
+}
+
 double PlumedForceImpl::calcForcesAndEnergy(ContextImpl& context, bool includeForces, bool includeEnergy, int groups) {
     if ((groups&(1<<owner.getForceGroup())) != 0)
         return kernel.getAs<CalcPlumedForceKernel>().execute(context, includeForces, includeEnergy);
@@ -59,3 +68,67 @@ std::vector<std::string> PlumedForceImpl::getKernelNames() {
     names.push_back(CalcPlumedForceKernel::Name());
     return names;
 }
+
+void PlumedForceImpl::getCollectiveVariableValues(vector<double>& values) const {
+    kernel.getAs<CalcPlumedForceKernel>().getCollectiveVariableValues(values);
+}
+
+double PlumedForceImpl::getBiasEnergy() const {
+    return kernel.getAs<CalcPlumedForceKernel>().getBiasEnergy();
+}
+
+std::shared_ptr<PlumedValueStorage> PlumedForceImpl::getValueStorage() const {
+    return kernel.getAs<CalcPlumedForceKernel>().getValueStorage();
+}
+
+shared_ptr<const vector<double> > PlumedForceImpl::getParticleMasses(const OpenMM::System& system, const PlumedForce& force) {
+    int numParticles = system.getNumParticles();
+    shared_ptr<const vector<double> > masses = force.getSharedMasses();
+    if (masses->size() == 0) { // User System masses
+        shared_ptr<vector<double> > systemMasses = make_shared<vector<double> >(numParticles);
+        for (int i = 0; i < numParticles; i++)
+            (*systemMasses)[i] = system.getParticleMass(i);
+        return systemMasses;
+    }
+    if (masses->size() != numParticles) // User PLUMED masses
+        throw OpenMMException("The number of PLUMED masses is different from the number of particles!");
+    return masses;
+}
+
+vector<double> PlumedForceImpl::getParticleCharges(const OpenMM::System& system) {
+    vector<double> charges;
+    for (int j = 0; j < system.getNumForces(); j++) {
+        const NonbondedForce* nonbonded = dynamic_cast<const NonbondedForce*>(&system.getForce(j));
+        if (nonbonded != NULL) {
+            charges.resize(system.getNumParticles());
+            double sigma, epsilon;
+            for (int i = 0; i < charges.size(); i++)
+                nonbonded->getParticleParameters(i, charges[i], sigma, epsilon);
+        }
+    }
+    return charges;
+}
+
+mutex& PlumedForceImpl::getInitializationLock() {
+    static mutex lock;
+    return lock;
+}
+
+void PlumedForceImpl::initializeMPI() {
+    int initialized;
+    MPI_Initialized(&initialized);
+    int provided;
+    if (!initialized)
+        MPI_Init_thread(NULL, NULL, MPI_THREAD_MULTIPLE, &provided);
+    else
+        MPI_Query_thread(&provided);
+
+    // Programs that use one Context at a time work with a lower level, so warn rather than fail, and only once.
+
+    static bool warned = false;
+    if (provided < MPI_THREAD_MULTIPLE && !warned) {
+        warned = true;
+        cerr << "Warning: MPI does not provide MPI_THREAD_MULTIPLE.  Contexts with a PlumedForce must not be created "
+                "or stepped from several threads at once." << endl;
+    }
+}
@@ -0,0 +1,141 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/PlumedHardwareCounters.h"
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include <cstring>
+
+using namespace PlumedPlugin;
+using namespace std;
+
+#ifdef __linux__
+
+namespace {
+
+const unsigned long long eventConfigs[PlumedHardwareCounters::NumEvents] = {
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES
+};
+
+/**
+ * The counters of one thread.  The first available event leads the group, so that all of them are scheduled, and
+ * read, together.
+ */
+struct CounterGroup {
+    CounterGroup() : numOpen(0) {
+        int leader = -1;
+        for (int i = 0; i < PlumedHardwareCounters::NumEvents; i++) {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = eventConfigs[i];
+            attr.disabled = (leader == -1);
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            fds[i] = syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+            if (fds[i] != -1) {
+                position[i] = numOpen++;
+                if (leader == -1)
+                    leader = fds[i];
+            }
+        }
+        if (leader != -1) {
+            ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+        this->leader = leader;
+    }
+    ~CounterGroup() {
+        for (int i = 0; i < PlumedHardwareCounters::NumEvents; i++)
+            if (fds[i] != -1)
+                close(fds[i]);
+    }
+    void read(long long* counts) {
+        // With PERF_FORMAT_GROUP the leader returns the number of events followed by their values.
+
+        unsigned long long data[1+PlumedHardwareCounters::NumEvents];
+        bool valid = (leader != -1 && ::read(leader, data, sizeof(data)) >= (ssize_t) ((1+numOpen)*sizeof(data[0])));
+        for (int i = 0; i < PlumedHardwareCounters::NumEvents; i++)
+            counts[i] = (valid && fds[i] != -1 ? data[1+position[i]] : 0);
+    }
+    int fds[PlumedHardwareCounters::NumEvents], position[PlumedHardwareCounters::NumEvents];
+    int numOpen, leader;
+};
+
+CounterGroup& getThreadGroup() {
+    thread_local CounterGroup group;
+    return group;
+}
+
+}
+
+bool PlumedHardwareCounters::isAvailable(Event event) {
+    // This is decided once, by opening a group on the first thread to ask.  Other threads are assumed to be allowed
+    // the same events.
+
+    static const struct Availability {
+        Availability() {
+            CounterGroup group;
+            for (int i = 0; i < NumEvents; i++)
+                available[i] = (group.fds[i] != -1);
+        }
+        bool available[NumEvents];
+    } availability;
+    return availability.available[event];
+}
+
+void PlumedHardwareCounters::read(long long* counts) {
+    getThreadGroup().read(counts);
+}
+
+#else
+
+bool PlumedHardwareCounters::isAvailable(Event event) {
+    return false;
+}
+
+void PlumedHardwareCounters::read(long long* counts) {
+    for (int i = 0; i < NumEvents; i++)
+        counts[i] = 0;
+}
+
+#endif
+
+void PlumedHardwareCounters::initializeCounters(double* counters, bool enabled) {
+    for (int i = 0; i < NumEvents; i++)
+        counters[i] = (enabled && isAvailable((Event) i) ? 0.0 : -1.0);
+}
@@ -0,0 +1,116 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/PlumedLoadBalanceMonitor.h"
+#include "internal/PlumedTracer.h"
+#include "openmm/OpenMMException.h"
+#include <algorithm>
+#include <cstdio>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+PlumedLoadBalanceMonitor::PlumedLoadBalanceMonitor(MPI_Comm comm, int interval, const string& filename) : comm(comm),
+        interval(interval), started(false) {
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &numReplicas);
+    int opened = 1;
+    if (rank == 0) {
+        out.open(filename.c_str());
+        opened = out.is_open();
+        if (opened)
+            out << "#  Step  Replica  Compute mean (ms)  Compute min (ms)  Compute max (ms)  Wait mean (ms)  Wait fraction" << endl;
+    }
+    MPI_Bcast(&opened, 1, MPI_INT, 0, comm);
+    if (!opened)
+        throw OpenMMException("PlumedLoadBalanceMonitor: cannot open the report file "+filename);
+}
+
+double PlumedLoadBalanceMonitor::synchronize(int step) {
+    PlumedTraceSpan span("wait for replicas", "mpi");
+    auto start = chrono::steady_clock::now();
+    MPI_Barrier(comm);
+    auto end = chrono::steady_clock::now();
+    double wait = chrono::duration<double>(end-start).count();
+
+    // The first step has no previous wait to measure the compute time from.
+
+    if (started) {
+        computeTimes.push_back(chrono::duration<double>(start-lastEnd).count());
+        waitTimes.push_back(wait);
+        if (computeTimes.size() == interval)
+            report(step);
+    }
+    started = true;
+    lastEnd = end;
+    return wait;
+}
+
+void PlumedLoadBalanceMonitor::report(int step) {
+    // Each replica reduces its own times to (compute sum, compute min, compute max, wait sum), and the first one
+    // gathers them.  The report is not part of the measured times.
+
+    auto start = chrono::steady_clock::now();
+    int numSteps = computeTimes.size();
+    double local[4] = {0.0, computeTimes[0], computeTimes[0], 0.0};
+    for (int i = 0; i < numSteps; i++) {
+        local[0] += computeTimes[i];
+        local[1] = min(local[1], computeTimes[i]);
+        local[2] = max(local[2], computeTimes[i]);
+        local[3] += waitTimes[i];
+    }
+    computeTimes.clear();
+    waitTimes.clear();
+    vector<double> all(rank == 0 ? 4*numReplicas : 0);
+    MPI_Gather(local, 4, MPI_DOUBLE, all.data(), 4, MPI_DOUBLE, 0, comm);
+    if (rank == 0) {
+        // For all replicas together, the minimum and maximum are those of the replicas' mean compute times, so that
+        // their ratios to the mean measure the imbalance.
+
+        char line[256];
+        double computeSum = 0.0, waitSum = 0.0, minMean = all[0]/numSteps, maxMean = all[0]/numSteps;
+        for (int i = 0; i < numReplicas; i++) {
+            const double* times = &all[4*i];
+            snprintf(line, sizeof(line), "%8d %8d %18.4f %17.4f %17.4f %15.4f %14.4f", step, i, 1000*times[0]/numSteps,
+                    1000*times[1], 1000*times[2], 1000*times[3]/numSteps, times[3]/(times[0]+times[3]));
+            out << line << "\n";
+            computeSum += times[0];
+            waitSum += times[3];
+            minMean = min(minMean, times[0]/numSteps);
+            maxMean = max(maxMean, times[0]/numSteps);
+        }
+        snprintf(line, sizeof(line), "%8d %8s %18.4f %17.4f %17.4f %15.4f %14.4f", step, "all", 1000*computeSum/(numSteps*numReplicas),
+                1000*minMean, 1000*maxMean, 1000*waitSum/(numSteps*numReplicas), waitSum/(computeSum+waitSum));
+        out << line << endl;
+    }
+    lastEnd += chrono::steady_clock::now()-start;
+}
@@ -0,0 +1,555 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/PlumedMetadynamics.h"
+#include "openmm/OpenMMException.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <map>
+#include <mpi.h>
+#include <sstream>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+// These match PLUMED's kBoltzmann and the cutoff of its stretched Gaussians (tools/Tools.h).
+
+static const double plumedBoltzmann = 0.0083144621;
+static const double dp2Cutoff = 6.25;
+static const double dp2CutoffA = 1.00193418799744762399;
+static const double dp2CutoffB = -.00193418799744762399;
+static const double openmmBoltzmann = 1.380649e-23*6.02214076e23/1000.0;
+
+struct PlumedMetadynamics::Variable {
+    // A DISTANCE has component -1, a component of a POSITION has component 0, 1 or 2.
+    int atom1, atom2, component;
+};
+
+struct PlumedMetadynamics::Grid {
+    vector<double> min, spacing;
+    vector<int> points;
+    vector<double> values, derivatives;
+    /**
+     * Get the index of the grid cell containing a point, throwing an exception if the point is outside the grid.
+     */
+    void getCell(const double* x, int* cell) const {
+        for (int i = 0; i < min.size(); i++) {
+            double position = (x[i]-min[i])/spacing[i];
+            if (!(position >= 0.0) || (int) floor(position) >= points[i])
+                throw OpenMMException("PlumedMetadynamics: a collective variable is outside the grid of the METAD");
+            cell[i] = (int) floor(position);
+        }
+    }
+};
+
+/**
+ * Split a line of the script into its label, its action and its keywords, or return false if the line uses syntax
+ * that is not supported here.  Flags are stored as keywords with an empty value.
+ */
+static bool parseLine(const string& line, string& label, string& action, map<string, string>& keywords) {
+    stringstream stream(line);
+    string word;
+    label = "";
+    action = "";
+    keywords.clear();
+    while (stream >> word) {
+        if (action == "" && label == "" && word.size() > 1 && word.back() == ':')
+            label = word.substr(0, word.size()-1);
+        else if (action == "")
+            action = word;
+        else {
+            size_t equals = word.find('=');
+            string key = word.substr(0, equals);
+            string value = (equals == string::npos ? "" : word.substr(equals+1));
+            if (key == "LABEL" && label == "")
+                label = value;
+            else if (key == "LABEL" || keywords.find(key) != keywords.end())
+                return false;
+            else
+                keywords[key] = value;
+        }
+    }
+    return true;
+}
+
+static bool parseDoubles(const string& text, vector<double>& values) {
+    values.clear();
+    stringstream stream(text);
+    string item;
+    while (getline(stream, item, ',')) {
+        char* end;
+        values.push_back(strtod(item.c_str(), &end));
+        if (item.empty() || *end != '\0')
+            return false;
+    }
+    return values.size() > 0;
+}
+
+static bool parseAtoms(const string& text, int numParticles, vector<int>& atoms) {
+    vector<double> values;
+    if (!parseDoubles(text, values))
+        return false;
+    atoms.clear();
+    for (double value : values) {
+        if (value != floor(value) || value < 1 || value > numParticles)
+            return false;
+        atoms.push_back((int) value-1);
+    }
+    return true;
+}
+
+/**
+ * Get the name PLUMED gives to a file for a replica: the suffix goes before an extension of up to four characters.
+ */
+static string appendSuffix(const string& filename, const string& suffix) {
+    size_t dot = filename.find_last_of('.');
+    if (dot == string::npos || dot == 0 || dot+1 == filename.size() || dot+5 < filename.size() ||
+            filename.find('/', dot) != string::npos || filename[dot-1] == '/')
+        return filename+suffix;
+    return filename.substr(0, dot)+suffix+filename.substr(dot);
+}
+
+/**
+ * Open a file for writing, first renaming any existing file to bck.N.name as PLUMED does.
+ */
+static FILE* openWithBackup(const string& filename) {
+    FILE* existing = fopen(filename.c_str(), "r");
+    if (existing != NULL) {
+        fclose(existing);
+        size_t slash = filename.find_last_of('/');
+        string directory = (slash == string::npos ? "" : filename.substr(0, slash+1));
+        string name = filename.substr(directory.size());
+        for (int i = 0; ; i++) {
+            string backup = directory+"bck."+to_string(i)+"."+name;
+            FILE* file = fopen(backup.c_str(), "r");
+            if (file == NULL) {
+                rename(filename.c_str(), backup.c_str());
+                break;
+            }
+            fclose(file);
+        }
+    }
+    return fopen(filename.c_str(), "w");
+}
+
+PlumedMetadynamics::PlumedMetadynamics() : numHills(0), isFirstUpdate(true), hillsFile(NULL) {
+}
+
+PlumedMetadynamics::~PlumedMetadynamics() {
+    if (hillsFile != NULL)
+        fclose(hillsFile);
+}
+
+unique_ptr<PlumedMetadynamics> PlumedMetadynamics::create(const PlumedForce& force, const System& system, double stepSize) {
+    if (!force.getUseNativeMetadynamics() || force.getRestart())
+        return nullptr;
+    unique_ptr<PlumedMetadynamics> metad(new PlumedMetadynamics());
+    map<string, int> variableIndex;
+    map<string, string> metadKeywords;
+    string metadLabel;
+    bool hasMetad = false;
+    stringstream script(force.getScript());
+    string line;
+    while (getline(script, line)) {
+        line = line.substr(0, line.find('#'));
+        string label, action;
+        map<string, string> keywords;
+        if (!parseLine(line, label, action, keywords))
+            return nullptr;
+        if (action == "")
+            continue;
+        if (action == "ENDPLUMED")
+            break;
+        bool noPBC = (keywords.erase("NOPBC") == 1);
+        if ((action == "DISTANCE" || action == "POSITION") && (label == "" || variableIndex.count(label) != 0))
+            return nullptr;
+        if ((action == "DISTANCE" || action == "POSITION") && system.usesPeriodicBoundaryConditions() && !noPBC)
+            return nullptr;
+        vector<int> atoms;
+        if (action == "DISTANCE") {
+            if (keywords.size() != 1 || keywords.count("ATOMS") == 0 || !parseAtoms(keywords["ATOMS"], system.getNumParticles(), atoms) || atoms.size() != 2)
+                return nullptr;
+            variableIndex[label] = metad->variables.size();
+            metad->variables.push_back({atoms[0], atoms[1], -1});
+        }
+        else if (action == "POSITION") {
+            if (keywords.size() != 1 || keywords.count("ATOM") == 0 || !parseAtoms(keywords["ATOM"], system.getNumParticles(), atoms) || atoms.size() != 1)
+                return nullptr;
+            const string components[] = {".x", ".y", ".z"};
+            for (int i = 0; i < 3; i++) {
+                variableIndex[label+components[i]] = metad->variables.size();
+                metad->variables.push_back({atoms[0], atoms[0], i});
+            }
+        }
+        else if (action == "METAD" && !hasMetad && !noPBC) {
+            hasMetad = true;
+            metadLabel = label;
+            metadKeywords = keywords;
+        }
+        else
+            return nullptr;
+    }
+    if (!hasMetad)
+        return nullptr;
+
+    // Check the keywords of the METAD.
+
+    const vector<string> allowed = {"ARG", "SIGMA", "HEIGHT", "PACE", "BIASFACTOR", "TEMP", "GRID_MIN", "GRID_MAX", "GRID_BIN", "FILE"};
+    for (auto& keyword : metadKeywords)
+        if (find(allowed.begin(), allowed.end(), keyword.first) == allowed.end())
+            return nullptr;
+    stringstream argStream(metadKeywords["ARG"]);
+    string arg;
+    while (getline(argStream, arg, ',')) {
+        if (variableIndex.count(arg) == 0)
+            return nullptr;
+        metad->args.push_back(variableIndex[arg]);
+    }
+    int numArgs = metad->args.size();
+    vector<double> height, pace;
+    if (numArgs == 0 || !parseDoubles(metadKeywords["SIGMA"], metad->sigma) || metad->sigma.size() != numArgs ||
+            !parseDoubles(metadKeywords["HEIGHT"], height) || height.size() != 1 || !parseDoubles(metadKeywords["PACE"], pace) ||
+            pace.size() != 1 || pace[0] < 1 || pace[0] != floor(pace[0]))
+        return nullptr;
+    for (double s : metad->sigma)
+        if (!(s > 0))
+            return nullptr;
+    metad->height = height[0];
+    metad->pace = (int) pace[0];
+    metad->biasFactor = 1.0;
+    metad->kT = force.getTemperature()*openmmBoltzmann;
+    vector<double> values;
+    if (metadKeywords.count("TEMP") != 0) {
+        if (!parseDoubles(metadKeywords["TEMP"], values) || values.size() != 1)
+            return nullptr;
+        metad->kT = values[0]*plumedBoltzmann;
+    }
+    if (metadKeywords.count("BIASFACTOR") != 0) {
+        if (!parseDoubles(metadKeywords["BIASFACTOR"], values) || values.size() != 1 || !(values[0] > 1.0) || !(metad->kT > 0.0))
+            return nullptr;
+        metad->biasFactor = values[0];
+    }
+    int numGridKeywords = metadKeywords.count("GRID_MIN")+metadKeywords.count("GRID_MAX")+metadKeywords.count("GRID_BIN");
+    if (numGridKeywords == 3) {
+        metad->grid.reset(new Grid());
+        Grid& grid = *metad->grid;
+        vector<double> max, bins;
+        if (!parseDoubles(metadKeywords["GRID_MIN"], grid.min) || !parseDoubles(metadKeywords["GRID_MAX"], max) ||
+                !parseDoubles(metadKeywords["GRID_BIN"], bins) || grid.min.size() != numArgs || max.size() != numArgs || bins.size() != numArgs)
+            return nullptr;
+        size_t size = 1;
+        for (int i = 0; i < numArgs; i++) {
+            if (!(max[i] > grid.min[i]) || bins[i] < 1 || bins[i] != floor(bins[i]))
+                return nullptr;
+            grid.spacing.push_back((max[i]-grid.min[i])/bins[i]);
+            grid.points.push_back((int) bins[i]+1);
+            size *= grid.points[i];
+        }
+        grid.values.resize(size, 0.0);
+        grid.derivatives.resize(size*numArgs, 0.0);
+    }
+    else if (numGridKeywords != 0)
+        return nullptr;
+
+    // Find the values to record.
+
+    for (const string& label : force.getCollectiveVariables()) {
+        if (variableIndex.count(label) != 0)
+            metad->recordedIndices.push_back(variableIndex[label]);
+        else if (metadLabel != "" && label == metadLabel+".bias")
+            metad->recordedIndices.push_back(-1);
+        else
+            return nullptr;
+    }
+
+    // Everything is supported.  Finish setting up.
+
+    for (double s : metad->sigma)
+        metad->invSigma.push_back(1.0/s);
+    metad->scaledCenters.resize(numArgs);
+    metad->values.resize(metad->variables.size());
+    metad->derivatives.resize(numArgs);
+    metad->recorded.resize(metad->recordedIndices.size(), 0.0);
+    metad->stepSize = stepSize;
+    metad->stretchA = dp2CutoffA;
+    metad->stretchB = dp2CutoffB;
+    if (getenv("PLUMED_DP2CUTOFF_NOSTRETCH") != NULL) {
+        metad->stretchA = 1.0;
+        metad->stretchB = 0.0;
+    }
+    int rank;
+    MPI_Comm_rank(force.getIntracom(), &rank);
+    if (rank == 0) {
+        // PLUMED appends the index of the replica to the names of the files.
+
+        int replica;
+        MPI_Comm_rank(force.getIntercom(), &replica);
+        string filename = appendSuffix(metadKeywords.count("FILE") != 0 ? metadKeywords["FILE"] : "HILLS", "."+to_string(replica));
+        metad->hillsFile = openWithBackup(filename);
+        if (metad->hillsFile == NULL)
+            throw OpenMMException("PlumedMetadynamics: cannot open the hills file "+filename);
+        vector<string> argNames(numArgs);
+        for (auto& variable : variableIndex)
+            for (int i = 0; i < numArgs; i++)
+                if (metad->args[i] == variable.second)
+                    argNames[i] = variable.first;
+        fprintf(metad->hillsFile, "#! FIELDS time");
+        for (const string& name : argNames)
+            fprintf(metad->hillsFile, " %s", name.c_str());
+        for (const string& name : argNames)
+            fprintf(metad->hillsFile, " sigma_%s", name.c_str());
+        fprintf(metad->hillsFile, " height biasf\n#! SET multivariate false\n#! SET kerneltype stretched-gaussian\n");
+        fflush(metad->hillsFile);
+    }
+    return metad;
+}
+
+double PlumedMetadynamics::calcForcesAndEnergy(const double* positions, double* forces, int step, bool update) {
+    // Compute the collective variables.
+
+    for (int i = 0; i < variables.size(); i++) {
+        const Variable& v = variables[i];
+        if (v.component == -1) {
+            double dx = positions[3*v.atom2]-positions[3*v.atom1];
+            double dy = positions[3*v.atom2+1]-positions[3*v.atom1+1];
+            double dz = positions[3*v.atom2+2]-positions[3*v.atom1+2];
+            values[i] = sqrt(dx*dx+dy*dy+dz*dz);
+        }
+        else
+            values[i] = positions[3*v.atom1+v.component];
+    }
+    int numArgs = args.size();
+    vector<double> cv(numArgs);
+    for (int i = 0; i < numArgs; i++)
+        cv[i] = values[args[i]];
+
+    // Compute the bias and apply the forces.
+
+    double bias = (grid ? evaluateGrid(&cv[0], &derivatives[0]) : evaluateHills(&cv[0], &derivatives[0]));
+    for (int i = 0; i < numArgs; i++) {
+        const Variable& v = variables[args[i]];
+        if (v.component == -1) {
+            double scale = derivatives[i]/values[args[i]];
+            for (int j = 0; j < 3; j++) {
+                double f = scale*(positions[3*v.atom2+j]-positions[3*v.atom1+j]);
+                forces[3*v.atom2+j] -= f;
+                forces[3*v.atom1+j] += f;
+            }
+        }
+        else
+            forces[3*v.atom1+v.component] -= derivatives[i];
+    }
+    if (!update)
+        return bias;
+
+    // Record the values, and deposit a hill every PACE steps except at the first update, as PLUMED does.
+
+    for (int i = 0; i < recordedIndices.size(); i++)
+        recorded[i] = (recordedIndices[i] == -1 ? bias : values[recordedIndices[i]]);
+    if (isFirstUpdate)
+        isFirstUpdate = false;
+    else if (step%pace == 0) {
+        double hillHeight = height;
+        if (biasFactor > 1.0)
+            hillHeight *= exp(-bias/(kT*(biasFactor-1.0)));
+        addHill(&cv[0], hillHeight);
+        writeHill(step, &cv[0], hillHeight);
+    }
+    return bias;
+}
+
+double PlumedMetadynamics::evaluateHills(const double* cv, double* der) {
+    // The loops run over hills in the inner loop, on contiguous arrays, so the compiler vectorizes them.
+
+    int numArgs = args.size();
+    int numHills = heights.size();
+    scratch.assign(numHills, 0.0);
+    double* dp2 = scratch.data();
+    for (int i = 0; i < numArgs; i++) {
+        const double* centers = scaledCenters[i].data();
+        double scaled = cv[i]*invSigma[i];
+        for (int j = 0; j < numHills; j++) {
+            double dp = scaled-centers[j];
+            dp2[j] += dp*dp;
+        }
+    }
+    double bias = 0.0;
+    const double* h = heights.data();
+    for (int j = 0; j < numHills; j++) {
+        double d = 0.5*dp2[j];
+        double weight = (d < dp2Cutoff ? h[j]*stretchA*exp(-d) : 0.0);
+        bias += (d < dp2Cutoff ? weight+h[j]*stretchB : 0.0);
+        dp2[j] = weight;
+    }
+    for (int i = 0; i < numArgs; i++) {
+        const double* centers = scaledCenters[i].data();
+        double scaled = cv[i]*invSigma[i];
+        double sum = 0.0;
+        for (int j = 0; j < numHills; j++)
+            sum += dp2[j]*(scaled-centers[j]);
+        der[i] = -sum*invSigma[i];
+    }
+    return bias;
+}
+
+double PlumedMetadynamics::evaluateGrid(const double* cv, double* der) const {
+    // This is PLUMED's spline interpolation, which uses the values and derivatives at the corners of the cell.
+
+    int numArgs = args.size();
+    vector<int> cell(numArgs);
+    grid->getCell(cv, &cell[0]);
+    vector<double> c(numArgs), d(numArgs);
+    for (int i = 0; i < numArgs; i++)
+        der[i] = 0.0;
+    double value = 0.0;
+    for (int corner = 0; corner < (1<<numArgs); corner++) {
+        size_t index = 0, stride = 1;
+        bool inside = true;
+        for (int i = 0; i < numArgs; i++) {
+            int point = cell[i]+((corner>>i)&1);
+            inside &= (point < grid->points[i]);
+            index += point*stride;
+            stride *= grid->points[i];
+        }
+        if (!inside)
+            continue;
+        double gridValue = grid->values[index];
+        const double* gridDerivatives = &grid->derivatives[index*numArgs];
+        double product = 1.0;
+        for (int i = 0; i < numArgs; i++) {
+            int x0 = (corner>>i)&1;
+            double dx = grid->spacing[i];
+            double xfloor = grid->min[i]+cell[i]*dx;
+            double X = fabs((cv[i]-xfloor)/dx-x0);
+            double X2 = X*X, X3 = X2*X;
+            double yy = (fabs(gridValue) < 1e-7 ? 0.0 : -gridDerivatives[i]/gridValue);
+            double sign = (x0 ? -1.0 : 1.0);
+            c[i] = (1.0-3.0*X2+2.0*X3) - sign*yy*(X-2.0*X2+X3)*dx;
+            d[i] = ((-6.0*X+6.0*X2) - sign*yy*(1.0-4.0*X+3.0*X2)*dx)*sign/dx;
+            product *= c[i];
+        }
+        value += gridValue*product;
+        for (int j = 0; j < numArgs; j++) {
+            double f = d[j];
+            for (int i = 0; i < numArgs; i++)
+                if (i != j)
+                    f *= c[i];
+            der[j] += gridValue*f;
+        }
+    }
+    return value;
+}
+
+void PlumedMetadynamics::addHill(const double* center, double hillHeight) {
+    int numArgs = args.size();
+    if (!grid) {
+        for (int i = 0; i < numArgs; i++)
+            scaledCenters[i].push_back(center[i]*invSigma[i]);
+        heights.push_back(hillHeight);
+        numHills++;
+        return;
+    }
+
+    // Add the hill to the grid points within its cutoff of the cell containing its center.
+
+    numHills++;
+    vector<int> cell(numArgs), first(numArgs), last(numArgs), point(numArgs);
+    vector<double> dp(numArgs);
+    grid->getCell(center, &cell[0]);
+    for (int i = 0; i < numArgs; i++) {
+        int range = (int) ceil(sqrt(2.0*dp2Cutoff)*sigma[i]/grid->spacing[i]);
+        first[i] = max(cell[i]-range, 0);
+        last[i] = min(cell[i]+range, grid->points[i]-1);
+    }
+    point = first;
+    while (true) {
+        size_t index = 0, stride = 1;
+        double dp2 = 0.0;
+        for (int i = 0; i < numArgs; i++) {
+            dp[i] = (grid->min[i]+point[i]*grid->spacing[i]-center[i])*invSigma[i];
+            dp2 += dp[i]*dp[i];
+            index += point[i]*stride;
+            stride *= grid->points[i];
+        }
+        dp2 *= 0.5;
+        if (dp2 < dp2Cutoff) {
+            double weight = hillHeight*stretchA*exp(-dp2);
+            grid->values[index] += weight+hillHeight*stretchB;
+            for (int i = 0; i < numArgs; i++)
+                grid->derivatives[index*numArgs+i] -= weight*dp[i]*invSigma[i];
+        }
+        int i = 0;
+        while (i < numArgs && point[i] == last[i]) {
+            point[i] = first[i];
+            i++;
+        }
+        if (i == numArgs)
+            break;
+        point[i]++;
+    }
+}
+
+void PlumedMetadynamics::writeHill(int step, const double* center, double hillHeight) {
+    if (hillsFile == NULL)
+        return;
+    int numArgs = args.size();
+    double scale = (biasFactor > 1.0 ? biasFactor/(biasFactor-1.0) : 1.0);
+    fprintf(hillsFile, " %22.16g", step*stepSize);
+    for (int i = 0; i < numArgs; i++)
+        fprintf(hillsFile, " %22.16g", center[i]);
+    for (int i = 0; i < numArgs; i++)
+        fprintf(hillsFile, " %22.16g", sigma[i]);
+    fprintf(hillsFile, " %22.16g %22.16g\n", hillHeight*scale, biasFactor);
+    fflush(hillsFile);
+}
+
+void PlumedMetadynamics::getRecordedValues(double* values) const {
+    for (int i = 0; i < recorded.size(); i++)
+        values[i] = recorded[i];
+}
+
+int PlumedMetadynamics::getNumHills() const {
+    return numHills;
+}
+
+vector<int> PlumedMetadynamics::getAtoms() const {
+    vector<int> atoms;
+    for (const Variable& v : variables) {
+        atoms.push_back(v.atom1);
+        if (v.component == -1)
+            atoms.push_back(v.atom2);
+    }
+    sort(atoms.begin(), atoms.end());
+    atoms.erase(unique(atoms.begin(), atoms.end()), atoms.end());
+    return atoms;
+}
@@ -0,0 +1,113 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/PlumedReuseCheck.h"
+
+#include <set>
+#include <sstream>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+PlumedReuseCheck::PlumedReuseCheck(double tolerance, const string& script) : tolerance(tolerance),
+        scriptIsStatic(isStatic(script)), hasRecord(false), step(0) {
+}
+
+bool PlumedReuseCheck::isStatic(const string& script) {
+    // Actions whose results only depend on the positions, and outputs that do not affect the bias.  Anything else,
+    // including actions read from other files, is assumed to depend on the step or on the updates.
+
+    static const set<string> staticActions = {"ALPHARMSD", "ANGLE", "ANTIBETARMSD", "BIASVALUE", "CENTER", "COM",
+            "COMBINE", "CONTACTMAP", "COORDINATION", "CUSTOM", "DIHCOR", "DISTANCE", "DRMSD", "DUMPATOMS", "ENDPLUMED",
+            "FIXEDATOM", "FLUSH", "GROUP", "GYRATION", "LOWER_WALLS", "MATHEVAL", "MOLINFO", "PARABETARMSD",
+            "POSITION", "PRINT", "RESTRAINT", "RMSD", "TORSION", "UNITS", "UPPER_WALLS", "WHOLEMOLECULES"};
+    stringstream stream(script);
+    string line;
+    bool continued = false;
+    while (getline(stream, line)) {
+        stringstream words(line.substr(0, line.find('#')));
+        string word, action;
+        while (action == "" && words >> word)
+            if (word.back() != ':' || word.size() == 1)
+                action = word;
+        if (action == "")
+            continue;
+
+        // Keywords may continue over several lines, from "ACTION ..." to a line starting with "...".
+
+        if (continued) {
+            continued = (action.compare(0, 3, "...") != 0);
+            continue;
+        }
+        if (staticActions.count(action) == 0)
+            return false;
+        if (action == "ENDPLUMED")
+            break;
+        while (words >> word)
+            if (word == "...")
+                continued = true;
+    }
+    return true;
+}
+
+bool PlumedReuseCheck::canReuse(const vector<int>& atoms, const Vec3* positions, const Vec3* box, int step) const {
+    if (!hasRecord || atoms != this->atoms || (!scriptIsStatic && step != this->step))
+        return false;
+    if (box != NULL)
+        for (int i = 0; i < 3; i++)
+            if (box[i] != this->box[i])
+                return false;
+    double tolerance2 = tolerance*tolerance;
+    for (int i = 0; i < atoms.size(); i++) {
+        Vec3 delta = positions[atoms[i]]-this->positions[i];
+        if (delta.dot(delta) > tolerance2)
+            return false;
+    }
+    return true;
+}
+
+void PlumedReuseCheck::record(const vector<int>& atoms, const Vec3* positions, const Vec3* box, int step) {
+    hasRecord = true;
+    this->step = step;
+    this->atoms = atoms;
+    this->positions.resize(atoms.size());
+    for (int i = 0; i < atoms.size(); i++)
+        this->positions[i] = positions[atoms[i]];
+    if (box != NULL)
+        for (int i = 0; i < 3; i++)
+            this->box[i] = box[i];
+}
+
+void PlumedReuseCheck::updated() {
+    if (!scriptIsStatic)
+        hasRecord = false;
+}
@@ -0,0 +1,132 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/PlumedStepSchedule.h"
+#include <cctype>
+#include <string>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+PlumedStepSchedule::PlumedStepSchedule(const Integrator& integrator, int forceGroup) : computationsAfterMoving(0),
+        currentStep(0), numComputations(0), numAfterMoving(0), inStep(false) {
+    const CustomIntegrator* custom = dynamic_cast<const CustomIntegrator*>(&integrator);
+    if (custom != NULL)
+        computationsAfterMoving = countComputationsAfterMoving(*custom, forceGroup);
+}
+
+/**
+ * Get whether an expression of a CustomIntegrator uses the forces or energy of a force group.
+ */
+static bool usesForceGroup(const string& expression, int forceGroup) {
+    string group = to_string(forceGroup);
+    int i = 0;
+    while (i < expression.size()) {
+        char c = expression[i];
+        if (isdigit(c) || c == '.') {
+            // Skip a number, so the exponent of 1e-3 is not read as a variable.
+
+            while (i < expression.size() && (isdigit(expression[i]) || expression[i] == '.'))
+                i++;
+            if (i < expression.size() && (expression[i] == 'e' || expression[i] == 'E')) {
+                i++;
+                if (i < expression.size() && (expression[i] == '+' || expression[i] == '-'))
+                    i++;
+                while (i < expression.size() && isdigit(expression[i]))
+                    i++;
+            }
+        }
+        else if (isalpha(c) || c == '_') {
+            int start = i;
+            while (i < expression.size() && (isalnum(expression[i]) || expression[i] == '_'))
+                i++;
+            string name = expression.substr(start, i-start);
+            if (name == "f" || name == "energy" || name == "f"+group || name == "energy"+group)
+                return true;
+        }
+        else
+            i++;
+    }
+    return false;
+}
+
+int PlumedStepSchedule::countComputationsAfterMoving(const CustomIntegrator& integrator, int forceGroup) {
+    // The forces computed at the end of a step are still valid at the start of the next one, so only uses of the
+    // forces after the positions change cause a computation.
+
+    int count = 0;
+    bool moved = false;
+    for (int i = 0; i < integrator.getNumComputations(); i++) {
+        CustomIntegrator::ComputationType type;
+        string variable, expression;
+        integrator.getComputationStep(i, type, variable, expression);
+        if (type == CustomIntegrator::ConstrainPositions || (type == CustomIntegrator::ComputePerDof && variable == "x")) {
+            moved = true;
+            continue;
+        }
+        if (moved && usesForceGroup(expression, forceGroup)) {
+            count++;
+            moved = false;
+        }
+    }
+    return count;
+}
+
+void PlumedStepSchedule::beginStep(int stepCount) {
+    inStep = true;
+    currentStep = stepCount;
+    numComputations = 0;
+    numAfterMoving = 0;
+}
+
+bool PlumedStepSchedule::needsPositionCheck(int stepCount) const {
+    return (computationsAfterMoving > 0 && inStep && stepCount == currentStep && numComputations == 0);
+}
+
+int PlumedStepSchedule::getStep(int stepCount, bool positionsChanged, bool& canUpdate) {
+    if (computationsAfterMoving == 0 || !inStep || stepCount != currentStep) {
+        // The forces are computed at the start of the step, or outside of one (for example by getState()).
+
+        canUpdate = true;
+        return stepCount;
+    }
+    numComputations++;
+    if (numComputations == 1 && !positionsChanged) {
+        // The forces were invalidated, so the integrator recomputes them before moving the particles.
+
+        canUpdate = true;
+        return stepCount;
+    }
+    numAfterMoving++;
+    canUpdate = (numAfterMoving == computationsAfterMoving);
+    return stepCount+1;
+}
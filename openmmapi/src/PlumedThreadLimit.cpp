@@ -0,0 +1,71 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/PlumedThreadLimit.h"
+#include <cstdlib>
+#include <mutex>
+
+using namespace PlumedPlugin;
+using namespace std;
+
+// The number of limits that exist, across all forces and threads.
+static mutex limitLock;
+static int numLimits = 0;
+
+PlumedThreadLimit::PlumedThreadLimit(PlumedKernelHandle& plumedmain, bool enabled) : plumedmain(plumedmain), enabled(enabled) {
+    if (!enabled)
+        return;
+    lock_guard<mutex> guard(limitLock);
+    if (numLimits++ == 0) {
+        // PLUMED's OpenMP loops reduce in an order that depends on the number of threads.
+
+        int numThreads = 1;
+        plumedmain.cmd("setNumOMPthreads", &numThreads);
+    }
+}
+
+PlumedThreadLimit::~PlumedThreadLimit() {
+    if (!enabled)
+        return;
+    lock_guard<mutex> guard(limitLock);
+    if (--numLimits == 0) {
+        int numThreads = getDefaultNumThreads();
+        plumedmain.cmd("setNumOMPthreads", &numThreads);
+    }
+}
+
+int PlumedThreadLimit::getDefaultNumThreads() {
+    // PLUMED reads its default from the environment the first time it is initialized.
+
+    const char* value = getenv("PLUMED_NUM_THREADS");
+    int numThreads = (value == NULL ? 1 : atoi(value));
+    return (numThreads < 1 ? 1 : numThreads);
+}
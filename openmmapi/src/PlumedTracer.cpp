@@ -0,0 +1,225 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "internal/PlumedTracer.h"
+#include <mpi.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace PlumedPlugin;
+using namespace std;
+
+namespace {
+
+struct TraceEvent {
+    const char* name;
+    const char* category;
+    long long start, end;
+};
+
+/**
+ * The events of one track.  Each thread appends to its own track, so the lock is only contended while the trace
+ * is being written.
+ */
+struct TraceTrack {
+    int id;
+    string name;
+    mutex lock;
+    vector<TraceEvent> events;
+};
+
+struct TraceRecorder {
+    TraceRecorder() : generation(0), rank(-1), numRanks(1), origin(0) {
+    }
+    ~TraceRecorder() {
+        // Threads that are still running may record events or create tracks, so take the lock like flush() does.
+
+        lock_guard<mutex> guard(lock);
+        if (PlumedTracer::isEnabled())
+            write();
+    }
+    shared_ptr<TraceTrack> createTrack(const string& name) {
+        shared_ptr<TraceTrack> track = make_shared<TraceTrack>();
+        track->id = tracks.size();
+        track->name = name;
+        tracks.push_back(track);
+        return track;
+    }
+    void findRank() {
+        // The rank is looked up while MPI is running, since the trace is usually written after MPI_Finalize().
+
+        int initialized, finalized;
+        MPI_Initialized(&initialized);
+        MPI_Finalized(&finalized);
+        if (initialized && !finalized) {
+            MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+            MPI_Comm_size(MPI_COMM_WORLD, &numRanks);
+        }
+    }
+    void write();
+    mutex lock;
+    string path;
+    atomic<int> generation;
+    int rank, numRanks;
+    long long origin;
+    vector<shared_ptr<TraceTrack> > tracks;
+    map<string, shared_ptr<TraceTrack> > deviceTracks;
+};
+
+TraceRecorder& getRecorder() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+string escape(const string& text) {
+    string result;
+    for (char c : text) {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        result += c;
+    }
+    return result;
+}
+
+void TraceRecorder::write() {
+    if (rank == -1)
+        findRank();
+    string filename = path;
+    if (numRanks > 1) {
+        size_t slash = filename.find_last_of('/');
+        size_t dot = filename.find_last_of('.');
+        if (dot == string::npos || (slash != string::npos && dot < slash))
+            dot = filename.size();
+        filename.insert(dot, "."+to_string(rank));
+    }
+    ofstream out(filename);
+    int pid = max(rank, 0);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":0,\"args\":{\"name\":\"OpenMM PLUMED rank " << pid << "\"}}";
+    out.setf(ios::fixed);
+    out.precision(3);
+    for (auto& track : tracks) {
+        lock_guard<mutex> guard(track->lock);
+        out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << track->id << ",\"args\":{\"name\":\"" << escape(track->name) << "\"}}";
+        out << ",\n{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << track->id << ",\"args\":{\"sort_index\":" << track->id << "}}";
+        for (const TraceEvent& event : track->events)
+            out << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":" << track->id
+                << ",\"ts\":" << (event.start-origin)*1e-3 << ",\"dur\":" << (event.end-event.start)*1e-3 << "}";
+    }
+    out << "\n]}\n";
+}
+
+/**
+ * Get the track of the calling thread, creating it the first time the thread records an event.
+ */
+TraceTrack& getThreadTrack() {
+    thread_local shared_ptr<TraceTrack> track;
+    thread_local int generation = -1;
+    TraceRecorder& recorder = getRecorder();
+    if (generation != recorder.generation) {
+        lock_guard<mutex> guard(recorder.lock);
+        if (recorder.rank == -1)
+            recorder.findRank();
+        track = recorder.createTrack(recorder.tracks.size() == 0 ? "main thread" : "thread "+to_string(recorder.tracks.size()));
+        generation = recorder.generation;
+    }
+    return *track;
+}
+
+struct TraceFromEnvironment {
+    TraceFromEnvironment() {
+        const char* path = getenv("OPENMM_PLUMED_TRACE");
+        if (path != NULL && path[0] != 0)
+            PlumedTracer::start(path);
+    }
+} traceFromEnvironment;
+
+}
+
+atomic<bool> PlumedTracer::enabled(false);
+
+void PlumedTracer::start(const string& path) {
+    TraceRecorder& recorder = getRecorder();
+    lock_guard<mutex> guard(recorder.lock);
+    recorder.path = path;
+    recorder.tracks.clear();
+    recorder.deviceTracks.clear();
+    recorder.generation++;
+    recorder.origin = now();
+    enabled = true;
+}
+
+void PlumedTracer::stop() {
+    if (!enabled)
+        return;
+    flush();
+    enabled = false;
+}
+
+void PlumedTracer::flush() {
+    TraceRecorder& recorder = getRecorder();
+    lock_guard<mutex> guard(recorder.lock);
+    recorder.write();
+}
+
+long long PlumedTracer::now() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void PlumedTracer::addSpan(const char* name, const char* category, long long start, long long end) {
+    TraceTrack& track = getThreadTrack();
+    lock_guard<mutex> guard(track.lock);
+    track.events.push_back({name, category, start, end});
+}
+
+void PlumedTracer::addDeviceSpan(const char* name, const char* track, long long start, long long end) {
+    TraceRecorder& recorder = getRecorder();
+    lock_guard<mutex> guard(recorder.lock);
+    shared_ptr<TraceTrack>& deviceTrack = recorder.deviceTracks[track];
+    if (!deviceTrack)
+        deviceTrack = recorder.createTrack(track);
+    lock_guard<mutex> trackGuard(deviceTrack->lock);
+    deviceTrack->events.push_back({name, "device", start, end});
+}
+
+void PlumedTracer::setThreadName(const char* name) {
+    if (!enabled)
+        return;
+    TraceTrack& track = getThreadTrack();
+    lock_guard<mutex> guard(getRecorder().lock);
+    track.name = name;
+}
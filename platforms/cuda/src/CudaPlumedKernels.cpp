@@ -31,13 +31,19 @@
 
 #include "CudaPlumedKernels.h"
 #include "CudaPlumedKernelSources.h"
-#include "openmm/NonbondedForce.h"
+#include "internal/PlumedForceImpl.h"
+#include "internal/PlumedHardwareCounters.h"
+#include "internal/PlumedForcePacking.h"
+#include "internal/PlumedThreadLimit.h"
+#include "internal/PlumedTracer.h"
 #include "openmm/internal/ContextImpl.h"
 #include "openmm/internal/ThreadPool.h"
 #include "openmm/cuda/CudaBondedUtilities.h"
 #include "openmm/cuda/CudaForceInfo.h"
 #include "openmm/reference/SimTKOpenMMRealType.h"
+#include <chrono>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <mpi.h>
 
@@ -60,6 +66,8 @@ public:
     ExecuteTask(CudaCalcPlumedForceKernel& owner) : owner(owner) {
     }
     void execute() {
+        PlumedTracer::setThreadName("OpenMM worker thread");
+        PlumedTraceSpan span("ExecuteTask");
         owner.executeOnWorkerThread();
     }
     CudaCalcPlumedForceKernel& owner;
@@ -67,36 +75,28 @@ public:
 
 class CudaCalcPlumedForceKernel::CopyForcesTask : public ThreadPool::Task {
 public:
-    CopyForcesTask(CudaContext& cu, vector<Vec3>& forces) : cu(cu), forces(forces) {
+    CopyForcesTask(CudaContext& cu, vector<Vec3>& forces, void* buffer, double* events, mutex& eventsLock) : cu(cu), forces(forces), buffer(buffer), events(events), eventsLock(eventsLock) {
     }
     void execute(ThreadPool& threads, int threadIndex) {
         // Copy the forces applied by PLUMED to a buffer for uploading.  This is done in parallel for speed.
         
+        PlumedTracer::setThreadName("OpenMM thread pool");
+        PlumedTraceSpan span("CopyForcesTask");
+        PlumedHardwareCounterScope counterScope(events, &eventsLock);
         int numParticles = cu.getNumAtoms();
         int numThreads = threads.getNumThreads();
         int start = threadIndex*numParticles/numThreads;
         int end = (threadIndex+1)*numParticles/numThreads;
-        if (cu.getUseDoublePrecision()) {
-            double* buffer = (double*) cu.getPinnedBuffer();
-            for (int i = start; i < end; ++i) {
-                const Vec3& p = forces[i];
-                buffer[3*i] = p[0];
-                buffer[3*i+1] = p[1];
-                buffer[3*i+2] = p[2];
-            }
-        }
-        else {
-            float* buffer = (float*) cu.getPinnedBuffer();
-            for (int i = start; i < end; ++i) {
-                const Vec3& p = forces[i];
-                buffer[3*i] = (float) p[0];
-                buffer[3*i+1] = (float) p[1];
-                buffer[3*i+2] = (float) p[2];
-            }
-        }
+        if (cu.getUseDoublePrecision())
+            packPlumedForces(forces, (double*) buffer, start, end);
+        else
+            packPlumedForces(forces, (float*) buffer, start, end);
     }
     CudaContext& cu;
     vector<Vec3>& forces;
+    void* buffer;
+    double* events;
+    mutex& eventsLock;
 };
 
 class CudaCalcPlumedForceKernel::AddForcesPostComputation : public CudaContext::ForcePostComputation {
@@ -111,94 +111,308 @@ public:
 
 CudaCalcPlumedForceKernel::~CudaCalcPlumedForceKernel() {
     cu.setAsCurrent();
+    if (coordinateExport)
+        coordinateExport->removeClient(exportClient);
     if (plumedForces != NULL)
         delete plumedForces;
+    if (pinnedForces != NULL)
+        cuMemFreeHost(pinnedForces);
     cuStreamDestroy(stream);
     cuEventDestroy(syncEvent);
-    if (hasInitialized)
-        plumed_finalize(plumedmain);
+    if (tracing) {
+        cuEventDestroy(traceOriginEvent);
+        for (int i = 0; i < 2; i++) {
+            cuEventDestroy(uploadEvents[i]);
+            cuEventDestroy(addForcesEvents[i]);
+        }
+    }
+    if (hasInitialized) {
+        lock_guard<mutex> guard(PlumedForceImpl::getInitializationLock());
+        plumedmain.finalize();
+    }
 }
 
 void CudaCalcPlumedForceKernel::initialize(const System& system, const PlumedForce& force) {
     cu.setAsCurrent();
     cuStreamCreate(&stream, CU_STREAM_NON_BLOCKING);
     cuEventCreate(&syncEvent, CU_EVENT_DISABLE_TIMING);
+    tracing = PlumedTracer::isEnabled();
+    if (tracing) {
+        cuEventCreate(&traceOriginEvent, CU_EVENT_DEFAULT);
+        for (int i = 0; i < 2; i++) {
+            cuEventCreate(&uploadEvents[i], CU_EVENT_DEFAULT);
+            cuEventCreate(&addForcesEvents[i], CU_EVENT_DEFAULT);
+        }
+        cuEventRecord(traceOriginEvent, stream);
+        cuEventSynchronize(traceOriginEvent);
+        traceOrigin = PlumedTracer::now();
+    }
     int elementSize = (cu.getUseDoublePrecision() ? sizeof(double) : sizeof(float));
     plumedForces = new CudaArray(cu, 3*system.getNumParticles(), elementSize, "plumedForces");
+    cuMemHostAlloc(&pinnedForces, plumedForces->getSize()*elementSize, CU_MEMHOSTALLOC_PORTABLE);
     map<string, string> defines;
     defines["NUM_ATOMS"] = cu.intToString(cu.getNumAtoms());
     defines["PADDED_NUM_ATOMS"] = cu.intToString(cu.getPaddedNumAtoms());
     CUmodule module = cu.createModule(CudaPlumedKernelSources::plumedForce, defines);
     addForcesKernel = cu.getKernel(module, "addForces");
+    invertAtomIndexKernel = cu.getKernel(module, "invertAtomIndex");
+    gatherPositionsKernel = cu.getKernel(module, "gatherPositions");
+    int mixedSize = (cu.getUseDoublePrecision() || cu.getUseMixedPrecision() ? sizeof(double) : sizeof(float));
+    exportSortedIndex.initialize<int>(cu, system.getNumParticles(), "exportSortedIndex");
+    exportAtoms.initialize<int>(cu, system.getNumParticles(), "exportAtoms");
+    exportPositions.initialize(cu, system.getNumParticles(), 4*mixedSize, "exportPositions");
+    exportAtomSortedIndex.initialize<int>(cu, system.getNumParticles(), "exportAtomSortedIndex");
+    coordinateExport = PlumedCoordinateExport::acquire(contextImpl);
+    exportClient = coordinateExport->addClient();
     forceGroupFlag = (1<<force.getForceGroup());
     cu.addPreComputation(new StartCalculationPreComputation(*this));
     cu.addPostComputation(new AddForcesPostComputation(*this));
 
     // Construct and initialize the PLUMED interface object.
 
-    plumedmain = plumed_create();
+    PlumedTraceSpan span("initialize");
+    lock_guard<mutex> guard(PlumedForceImpl::getInitializationLock());
+    PlumedForceImpl::initializeMPI();
+    const vector<string>& labels = force.getCollectiveVariables();
+    storage.reset(new PlumedValueStorage(labels.size()));
+
+    // Prepare to count hardware events.  Those the system does not allow to count are marked with -1, as are those
+    // of PLUMED's computation when it may run on several threads.
+
+    useHardwareCounters = force.getUseHardwareCounters();
+    deterministic = force.getDeterministic();
+    countCalculationEvents = (useHardwareCounters && (deterministic || PlumedThreadLimit::getDefaultNumThreads() == 1));
+    if (useHardwareCounters) {
+        PlumedHardwareCounters::initializeCounters(storage->getCounters()+PlumedValueStorage::CalculationCycles, countCalculationEvents);
+        PlumedHardwareCounters::initializeCounters(storage->getCounters()+PlumedValueStorage::TransferCycles);
+    }
+
+    // Record the particle masses and charges.  Masses set on the force are shared with it, not copied.
+
+    masses = PlumedForceImpl::getParticleMasses(system, force);
+    charges = PlumedForceImpl::getParticleCharges(system);
+
+    // Which step each computation belongs to depends on when the integrator computes the forces.
+
+    schedule.reset(new PlumedStepSchedule(contextImpl.getIntegrator(), force.getForceGroup()));
+
+    // Metadynamics the plugin supports itself does not need PLUMED at all.  It runs on the worker thread in place
+    // of PLUMED, and its forces are uploaded the same way.
+
+    metadynamics = PlumedMetadynamics::create(force, system, contextImpl.getIntegrator().getStepSize());
+    if (metadynamics) {
+        neededAtoms = metadynamics->getAtoms();
+        return;
+    }
+    plumedmain.create();
+    PlumedTraceSpan mpiSpan("GREX init", "mpi");
+    int intra_comm_rank;
+    MPI_Comm intra_comm = force.getIntracom();
+    MPI_Comm inter_comm = force.getIntercom();
+    MPI_Comm_rank(intra_comm, &intra_comm_rank);
+    if (intra_comm_rank == 0)
+        plumedmain.cmd("GREX setMPIIntercomm", &inter_comm);
+    plumedmain.cmd("GREX setMPIIntracomm", &intra_comm);
+    plumedmain.cmd("GREX init");
+    plumedmain.cmd("setMPIComm", &intra_comm);
+    mpiSpan.end();
+    if (force.getLoadBalanceReportInterval() > 0 && intra_comm_rank == 0)
+        loadBalance.reset(new PlumedLoadBalanceMonitor(inter_comm, force.getLoadBalanceReportInterval(), force.getLoadBalanceReportFile()));
     hasInitialized = true;
     int apiVersion;
-    plumed_cmd(plumedmain, "getApiVersion", &apiVersion);
+    plumedmain.cmd("getApiVersion", &apiVersion);
     if (apiVersion < 4)
         throw OpenMMException("Unsupported API version.  Upgrade PLUMED to a newer version.");
     int precision = 8;
-    plumed_cmd(plumedmain, "setRealPrecision", &precision);
+    plumedmain.cmd("setRealPrecision", &precision);
     double conversion = 1.0;
-    plumed_cmd(plumedmain, "setMDEnergyUnits", &conversion);
-    plumed_cmd(plumedmain, "setMDLengthUnits", &conversion);
-    plumed_cmd(plumedmain, "setMDTimeUnits", &conversion);
-    plumed_cmd(plumedmain, "setMDEngine", "OpenMM");
-    plumed_cmd(plumedmain, "setLog", force.getLogStream());
+    plumedmain.cmd("setMDEnergyUnits", &conversion);
+    plumedmain.cmd("setMDLengthUnits", &conversion);
+    plumedmain.cmd("setMDTimeUnits", &conversion);
+    plumedmain.cmd("setMDEngine", "OpenMM");
+    logStream = force.getSharedLogStream();
+    plumedmain.cmd("setLog", logStream.get());
     int numParticles = system.getNumParticles();
-    plumed_cmd(plumedmain, "setNatoms", &numParticles);
+    plumedmain.cmd("setNatoms", &numParticles);
     double dt = contextImpl.getIntegrator().getStepSize();
-    plumed_cmd(plumedmain, "setTimestep", &dt);
+    plumedmain.cmd("setTimestep", &dt);
     double kT = force.getTemperature() * BOLTZ;
     if (kT >= 0.0)
-        plumed_cmd(plumedmain, "setKbT", &kT);
+        plumedmain.cmd("setKbT", &kT);
     int restart = force.getRestart();
-    plumed_cmd(plumedmain, "setRestart", &restart);
-    plumed_cmd(plumedmain, "setMPIComm", force.getMPI());
-    plumed_cmd(plumedmain, "init", NULL);
+    plumedmain.cmd("setRestart", &restart);
+    plumedmain.cmd("init");
+
+    // COORDINATION and CONTACTMAP actions the plugin computes itself are replaced by EXTRACV in the script.
+
+    contacts = PlumedContactVariables::create(force, system);
+    const string& script = (contacts ? contacts->getScript() : force.getScript());
+    if (contacts) {
+        contactValues.resize(contacts->getNumVariables());
+        contactForces.resize(contacts->getNumVariables());
+        initializeContacts();
+    }
     if(apiVersion > 7) {
-        plumed_cmd(plumedmain, "readInputLines", force.getScript().c_str());
+        plumedmain.cmd("readInputLines", script.c_str());
     } else {
         // NOTE: the comments and line continuation does not works
         //       (https://github.com/plumed/plumed2/issues/571)
         // TODO: remove this when PLUMED 2.6 support is dropped
-        vector<char> scriptChars(force.getScript().size()+1);
-        strcpy(&scriptChars[0], force.getScript().c_str());
+        vector<char> scriptChars(script.size()+1);
+        strcpy(&scriptChars[0], script.c_str());
         char* line = strtok(&scriptChars[0], "\r\n");
         while (line != NULL) {
-            plumed_cmd(plumedmain, "readInputLine", line);
+            plumedmain.cmd("readInputLine", line);
             line = strtok(NULL, "\r\n");
         }
     }
     usesPeriodic = system.usesPeriodicBoundaryConditions();
 
-    // Record the particle masses.
-
-    masses.resize(numParticles);
-    const auto& plumedMasses = force.getMasses();
-    if (plumedMasses.size() == 0) // User System masses
-        for (int i = 0; i < numParticles; i++)
-            masses[i] = system.getParticleMass(i);
-    else if (plumedMasses.size() == numParticles) // User PLUMED masses
-        masses = plumedMasses;
-    else
-        throw OpenMMException("The number of PLUMED masses is different from the number of particles!");
-
-    // If there's a NonbondedForce, get charges from it.
-
-    for (int j = 0; j < system.getNumForces(); j++) {
-        const NonbondedForce* nonbonded = dynamic_cast<const NonbondedForce*>(&system.getForce(j));
-        if (nonbonded != NULL) {
-            charges.resize(numParticles);
-            double sigma, epsilon;
-            for (int i = 0; i < numParticles; i++)
-                nonbonded->getParticleParameters(i, charges[i], sigma, epsilon);
-        }
+    // Results may only be reused if no other replica takes part in the calculation.
+
+    int numReplicas = 1;
+    if (intra_comm_rank == 0)
+        MPI_Comm_size(inter_comm, &numReplicas);
+    MPI_Bcast(&numReplicas, 1, MPI_INT, 0, intra_comm);
+    if (force.getReuseTolerance() > 0 && numReplicas == 1 && !contacts)
+        reuse.reset(new PlumedReuseCheck(force.getReuseTolerance(), force.getScript()));
+
+    // Ask PLUMED to store the requested values every time it computes them.
+
+    for (int i = 0; i < labels.size(); i++)
+        plumedmain.cmd(("setMemoryForData "+labels[i]).c_str(), storage->getValues()+i);
+}
+
+void CudaCalcPlumedForceKernel::initializeContacts() {
+    int numVariables = contacts->getNumVariables();
+    const vector<int>& variableStart = contacts->getVariableStart();
+    int numPairs = variableStart[numVariables];
+    vector<int> pairVariable(numPairs), atoms, atomStart, atomEntries;
+    for (int i = 0; i < numVariables; i++)
+        for (int j = variableStart[i]; j < variableStart[i+1]; j++)
+            pairVariable[j] = i;
+    contacts->getAtomPairs(atoms, atomStart, atomEntries);
+
+    // Copy the pairs and their parameters to the device.  In single precision the parameters are converted to
+    // float, clamping the infinite cutoff of switching functions without D_MAX.
+
+    bool useDouble = cu.getUseDoublePrecision();
+    useDoubleContactValues = (useDouble || cu.getUseMixedPrecision());
+    int realSize = (useDouble ? sizeof(double) : sizeof(float));
+    int mixedSize = (useDoubleContactValues ? sizeof(double) : sizeof(float));
+    const vector<double>& parameters = contacts->getPairParameters();
+    contactPositions.initialize(cu, cu.getNumAtoms(), 4*realSize, "contactPositions");
+    contactPairAtoms.initialize(cu, numPairs, 2*sizeof(int), "contactPairAtoms");
+    contactPairParameters.initialize(cu, parameters.size(), realSize, "contactPairParameters");
+    contactPairValues.initialize(cu, numPairs, realSize, "contactPairValues");
+    contactPairDerivatives.initialize(cu, numPairs, 4*realSize, "contactPairDerivatives");
+    contactVariableStart.initialize<int>(cu, numVariables+1, "contactVariableStart");
+    contactPairVariable.initialize<int>(cu, numPairs, "contactPairVariable");
+    contactAtoms.initialize<int>(cu, atoms.size(), "contactAtoms");
+    contactAtomStart.initialize<int>(cu, atomStart.size(), "contactAtomStart");
+    contactAtomEntries.initialize<int>(cu, atomEntries.size(), "contactAtomEntries");
+    contactVariableValues.initialize(cu, numVariables, mixedSize, "contactVariableValues");
+    contactVariableForces.initialize(cu, numVariables, mixedSize, "contactVariableForces");
+    contactPairAtoms.upload(contacts->getPairAtoms().data());
+    if (useDouble)
+        contactPairParameters.upload(parameters.data());
+    else {
+        vector<float> floatParameters(parameters.size());
+        for (int i = 0; i < parameters.size(); i++)
+            floatParameters[i] = (float) min(parameters[i], (double) numeric_limits<float>::max());
+        contactPairParameters.upload(floatParameters);
+    }
+    contactVariableStart.upload(variableStart);
+    contactPairVariable.upload(pairVariable);
+    contactAtoms.upload(atoms);
+    contactAtomStart.upload(atomStart);
+    contactAtomEntries.upload(atomEntries);
+
+    // Create the kernels.
+
+    map<string, string> defines;
+    defines["NUM_ATOMS"] = cu.intToString(cu.getNumAtoms());
+    defines["NUM_PAIRS"] = cu.intToString(numPairs);
+    defines["NUM_CONTACT_VARIABLES"] = cu.intToString(numVariables);
+    defines["NUM_CONTACT_ATOMS"] = cu.intToString(atoms.size());
+    defines["CONTACT_BLOCK_SIZE"] = "128";
+    defines["NUM_PARAMETERS"] = cu.intToString(PlumedContactVariables::NumParameters);
+    defines["PARAMETER_INVR0"] = cu.intToString(PlumedContactVariables::InvR0);
+    defines["PARAMETER_D0"] = cu.intToString(PlumedContactVariables::D0);
+    defines["PARAMETER_NN"] = cu.intToString(PlumedContactVariables::NN);
+    defines["PARAMETER_MM"] = cu.intToString(PlumedContactVariables::MM);
+    defines["PARAMETER_DMAX"] = cu.intToString(PlumedContactVariables::DMax);
+    defines["PARAMETER_STRETCH"] = cu.intToString(PlumedContactVariables::Stretch);
+    defines["PARAMETER_SHIFT"] = cu.intToString(PlumedContactVariables::Shift);
+    defines["PARAMETER_WEIGHT"] = cu.intToString(PlumedContactVariables::Weight);
+    defines["PARAMETER_PERIODIC"] = cu.intToString(PlumedContactVariables::Periodic);
+    defines["SWITCH_EPSILON"] = cu.doubleToString(100*(useDouble ? numeric_limits<double>::epsilon() : numeric_limits<float>::epsilon()));
+    CUmodule module = cu.createModule(CudaPlumedKernelSources::contactVariables, defines);
+    gatherContactPositionsKernel = cu.getKernel(module, "gatherContactPositions");
+    computeContactPairsKernel = cu.getKernel(module, "computeContactPairs");
+    sumContactVariablesKernel = cu.getKernel(module, "sumContactVariables");
+    addContactForcesKernel = cu.getKernel(module, "addContactForces");
+}
+
+void CudaCalcPlumedForceKernel::transferPositions(const vector<int>& atoms, bool allAtoms, vector<Vec3>& result) {
+    if (allAtoms) {
+        contextImpl.getPositions(result);
+        return;
+    }
+
+    // Gather the atoms on the device and download only them.
+
+    int numAtoms = atoms.size();
+    exportAtoms.uploadSubArray(atoms.data(), 0, numAtoms);
+    void* invertArgs[] = {&cu.getAtomIndexArray().getDevicePointer(), &exportSortedIndex.getDevicePointer()};
+    cu.executeKernel(invertAtomIndexKernel, invertArgs, cu.getNumAtoms());
+    CUdeviceptr correction = (cu.getUseMixedPrecision() ? cu.getPosqCorrection().getDevicePointer() : cu.getPosq().getDevicePointer());
+    void* gatherArgs[] = {&cu.getPosq().getDevicePointer(), &correction, &exportSortedIndex.getDevicePointer(), &exportAtoms.getDevicePointer(),
+            &numAtoms, &exportPositions.getDevicePointer(), &exportAtomSortedIndex.getDevicePointer()};
+    cu.executeKernel(gatherPositionsKernel, gatherArgs, numAtoms);
+    downloadedSortedIndex.resize(numAtoms);
+    cuMemcpyDtoHAsync(downloadedSortedIndex.data(), exportAtomSortedIndex.getDevicePointer(), numAtoms*sizeof(int), cu.getCurrentStream());
+    if (exportPositions.getElementSize() == 4*sizeof(double)) {
+        downloadedPositions.resize(4*numAtoms);
+        cuMemcpyDtoHAsync(downloadedPositions.data(), exportPositions.getDevicePointer(), numAtoms*exportPositions.getElementSize(), cu.getCurrentStream());
+        cuStreamSynchronize(cu.getCurrentStream());
+    }
+    else {
+        vector<float> floatPositions(4*numAtoms);
+        cuMemcpyDtoHAsync(floatPositions.data(), exportPositions.getDevicePointer(), numAtoms*exportPositions.getElementSize(), cu.getCurrentStream());
+        cuStreamSynchronize(cu.getCurrentStream());
+        downloadedPositions.assign(floatPositions.begin(), floatPositions.end());
+    }
+
+    // Undo the periodic wrapping the same way ContextImpl::getPositions() does.
+
+    Vec3 boxVectors[3];
+    cu.getPeriodicBoxVectors(boxVectors[0], boxVectors[1], boxVectors[2]);
+    const vector<mm_int4>& offsets = cu.getPosCellOffsets();
+    for (int i = 0; i < numAtoms; i++) {
+        const mm_int4& offset = offsets[downloadedSortedIndex[i]];
+        Vec3 pos(downloadedPositions[4*i], downloadedPositions[4*i+1], downloadedPositions[4*i+2]);
+        result[atoms[i]] = pos-boxVectors[0]*offset.x-boxVectors[1]*offset.y-boxVectors[2]*offset.z;
+    }
+}
+
+void CudaCalcPlumedForceKernel::computeContacts() {
+    int numVariables = contacts->getNumVariables();
+    int triclinic = cu.getBoxIsTriclinic();
+    void* gatherArgs[] = {&cu.getPosq().getDevicePointer(), &cu.getAtomIndexArray().getDevicePointer(), &contactPositions.getDevicePointer()};
+    cu.executeKernel(gatherContactPositionsKernel, gatherArgs, cu.getNumAtoms());
+    void* pairArgs[] = {&contactPositions.getDevicePointer(), &contactPairAtoms.getDevicePointer(), &contactPairParameters.getDevicePointer(),
+            &contactPairValues.getDevicePointer(), &contactPairDerivatives.getDevicePointer(), cu.getPeriodicBoxVecXPointer(),
+            cu.getPeriodicBoxVecYPointer(), cu.getPeriodicBoxVecZPointer(), &triclinic};
+    cu.executeKernel(computeContactPairsKernel, pairArgs, contactPairValues.getSize());
+    void* sumArgs[] = {&contactPairValues.getDevicePointer(), &contactVariableStart.getDevicePointer(), &contactVariableValues.getDevicePointer()};
+    cu.executeKernel(sumContactVariablesKernel, sumArgs, numVariables*128, 128);
+    if (useDoubleContactValues)
+        contactVariableValues.download(contactValues.data());
+    else {
+        vector<float> values(numVariables);
+        contactVariableValues.download(values.data());
+        contactValues.assign(values.begin(), values.end());
     }
 }
 
@@ -209,55 +423,200 @@ double CudaCalcPlumedForceKernel::execute(ContextImpl& context, bool includeForc
     return 0;
 }
 
+void CudaCalcPlumedForceKernel::beginStep(ContextImpl& context) {
+    schedule->beginStep(context.getStepCount());
+}
+
 void CudaCalcPlumedForceKernel::beginComputation(bool includeForces, bool includeEnergy, int groups) {
     if ((groups&forceGroupFlag) == 0)
         return;
-    contextImpl.getPositions(positions);
+    if (tracing)
+        recordDeviceSpans();
+    int stepCount = cu.getStepCount();
+    bool positionsChanged = false;
+    if (schedule->needsPositionCheck(stepCount) && checkedAtoms.size() > 0) {
+        // Compare the atoms the previous computation used, which are still in neededAtoms, to tell whether the
+        // integrator moved the particles before this computation.  The transfer also serves this computation, which
+        // usually needs the same atoms.
+
+        getNeededPositions();
+        for (int i = 0; i < checkedAtoms.size() && !positionsChanged; i++)
+            positionsChanged = (positions[checkedAtoms[i]] != checkedPositions[i]);
+    }
+    step = schedule->getStep(stepCount, positionsChanged, update);
+    update = (update && step != lastStepIndex);
+    if (update)
+        lastStepIndex = step;
+    if (!metadynamics) {
+        // Ask PLUMED which atoms the actions active at this step use.  The worker thread then only needs to share
+        // the data, since the dependencies are already prepared.
+
+        PlumedTraceSpan span("prepareDependencies", "plumed");
+        plumedmain.cmd("setStep", &step);
+        plumedmain.cmd("prepareDependencies");
+        int numAtoms;
+        const int* atoms;
+        plumedmain.cmd("createFullList", &numAtoms);
+        plumedmain.cmd("getFullList", &atoms);
+        neededAtoms.assign(atoms, atoms+numAtoms);
+        plumedmain.cmd("clearFullList");
+    }
+    getNeededPositions();
+    if (schedule->getComputationsAfterMoving() > 0) {
+        checkedAtoms = neededAtoms;
+        checkedPositions.resize(neededAtoms.size());
+        for (int i = 0; i < neededAtoms.size(); i++)
+            checkedPositions[i] = positions[neededAtoms[i]];
+    }
+    if (reuse) {
+        // If the atoms barely moved since PLUMED last computed the bias, addForces() adds the same forces again, which
+        // are still on the device, and PLUMED is only updated.
+
+        Vec3 boxVectors[3];
+        contextImpl.getPeriodicBoxVectors(boxVectors[0], boxVectors[1], boxVectors[2]);
+        if (reuse->canReuse(neededAtoms, positions, usesPeriodic ? boxVectors : NULL, step)) {
+            if (update) {
+                PlumedTraceSpan span("update", "plumed");
+                PlumedThreadLimit threadLimit(plumedmain, deterministic);
+                plumedmain.cmd("update");
+                reuse->updated();
+            }
+            storage->getCounters()[PlumedValueStorage::ReusedCalculations]++;
+            return;
+        }
+        reuse->record(neededAtoms, positions, usesPeriodic ? boxVectors : NULL, step);
+
+        // The worker thread updates PLUMED after this computation, which may change the bias.
+
+        if (update)
+            reuse->updated();
+    }
+    if (contacts) {
+        auto contactsStart = chrono::steady_clock::now();
+        computeContacts();
+        storage->getCounters()[PlumedValueStorage::TransferTime] += chrono::duration<double>(chrono::steady_clock::now()-contactsStart).count();
+    }
     
     // The actual force computation will be done on a different thread.
     
     cu.getWorkThread().addTask(new ExecuteTask(*this));
 }
 
+void CudaCalcPlumedForceKernel::getNeededPositions() {
+    PlumedTraceSpan span("getPositions");
+    auto transferStart = chrono::steady_clock::now();
+    bool allAtoms = (neededAtoms.size() == contextImpl.getSystem().getNumParticles());
+    positions = coordinateExport->getPositions(exportClient, cu.getComputeForceCount(), neededAtoms, allAtoms,
+            [this] (const vector<int>& atoms, bool allAtoms, vector<Vec3>& result) {transferPositions(atoms, allAtoms, result);}).data();
+    storage->getCounters()[PlumedValueStorage::TransferTime] += chrono::duration<double>(chrono::steady_clock::now()-transferStart).count();
+}
+
 void CudaCalcPlumedForceKernel::executeOnWorkerThread() {
     // Configure the PLUMED interface object.
     
     int numParticles = contextImpl.getSystem().getNumParticles();
-    int step = cu.getStepCount();
-    plumed_cmd(plumedmain, "setStep", &step);
-    plumed_cmd(plumedmain, "setMasses", &masses[0]);
-    if (charges.size() > 0)
-        plumed_cmd(plumedmain, "setCharges", &charges[0]);
-    plumed_cmd(plumedmain, "setPositions", &positions[0][0]);
     forces.resize(numParticles);
     memset(&forces[0], 0, numParticles*sizeof(Vec3));
-    plumed_cmd(plumedmain, "setForces", &forces[0][0]);
+    double* counters = storage->getCounters();
+    if (metadynamics) {
+        auto calcStart = chrono::steady_clock::now();
+        PlumedHardwareCounterScope calcEvents(countCalculationEvents ? counters+PlumedValueStorage::CalculationCycles : NULL);
+        storage->getBias() = metadynamics->calcForcesAndEnergy(&positions[0][0], &forces[0][0], step, update);
+        if (update)
+            metadynamics->getRecordedValues(storage->getValues());
+        calcEvents.end();
+        counters[PlumedValueStorage::NumCalculations]++;
+        counters[PlumedValueStorage::CalculationTime] += chrono::duration<double>(chrono::steady_clock::now()-calcStart).count();
+        uploadForces();
+        return;
+    }
+    plumedmain.cmd("setMasses", masses->data());
+    if (charges.size() > 0)
+        plumedmain.cmd("setCharges", &charges[0]);
+    plumedmain.cmd("setPositions", &positions[0][0]);
+    plumedmain.cmd("setForces", &forces[0][0]);
     if (usesPeriodic) {
         Vec3 boxVectors[3];
         contextImpl.getPeriodicBoxVectors(boxVectors[0], boxVectors[1], boxVectors[2]);
-        plumed_cmd(plumedmain, "setBox", &boxVectors[0][0]);
+        plumedmain.cmd("setBox", &boxVectors[0][0]);
     }
     double virial[9];
-    plumed_cmd(plumedmain, "setVirial", &virial);
+    plumedmain.cmd("setVirial", &virial);
+    if (contacts) {
+        // The values were computed on the device by beginComputation().  PLUMED adds the forces on them to
+        // contactForces, which uploadForces() applies to the atoms.
+
+        for (int i = 0; i < contacts->getNumVariables(); i++) {
+            contactForces[i] = 0.0;
+            plumedmain.cmd(("setExtraCV "+contacts->getVariableName(i)).c_str(), &contactValues[i]);
+            plumedmain.cmd(("setExtraCVForce "+contacts->getVariableName(i)).c_str(), &contactForces[i]);
+        }
+    }
 
     // Calculate the forces and energy.
 
-    plumed_cmd(plumedmain, "prepareCalc", NULL);
-    plumed_cmd(plumedmain, "performCalcNoUpdate", NULL);
-    if (step != lastStepIndex) {
-        plumed_cmd(plumedmain, "update", NULL);
-        lastStepIndex = step;
+    if (loadBalance && update)
+        counters[PlumedValueStorage::ReplicaWaitTime] += loadBalance->synchronize(step);
+    auto calcStart = chrono::steady_clock::now();
+    PlumedHardwareCounterScope calcEvents(countCalculationEvents ? counters+PlumedValueStorage::CalculationCycles : NULL);
+    PlumedThreadLimit threadLimit(plumedmain, deterministic);
+    {
+        PlumedTraceSpan span("shareData", "plumed");
+        plumedmain.cmd("shareData");
+    }
+    if (update) {
+        // performCalc also runs the update and fills the buffers registered with setMemoryForData.
+        PlumedTraceSpan span("performCalc", "plumed");
+        plumedmain.cmd("performCalc");
+    }
+    else {
+        PlumedTraceSpan span("performCalcNoUpdate", "plumed");
+        plumedmain.cmd("performCalcNoUpdate");
     }
+    calcEvents.end();
+    counters[PlumedValueStorage::NumCalculations]++;
+    counters[PlumedValueStorage::CalculationTime] += chrono::duration<double>(chrono::steady_clock::now()-calcStart).count();
     
     // Upload the forces to the device.
     
-    CopyForcesTask task(cu, forces);
+    uploadForces();
+}
+
+void CudaCalcPlumedForceKernel::uploadForces() {
+    int numParticles = contextImpl.getSystem().getNumParticles();
+    double* counters = storage->getCounters();
+    auto transferStart = chrono::steady_clock::now();
+    CopyForcesTask task(cu, forces, pinnedForces, useHardwareCounters ? counters+PlumedValueStorage::TransferCycles : NULL, hardwareCountersLock);
     cu.getPlatformData().threads.execute(task);
     cu.getPlatformData().threads.waitForThreads();
     cu.setAsCurrent();
-    cuMemcpyHtoDAsync(plumedForces->getDevicePointer(), cu.getPinnedBuffer(), plumedForces->getSize()*plumedForces->getElementSize(), stream);
+    PlumedTraceSpan uploadSpan("upload forces");
+    if (tracing)
+        cuEventRecord(uploadEvents[0], stream);
+    cuMemcpyHtoDAsync(plumedForces->getDevicePointer(), pinnedForces, plumedForces->getSize()*plumedForces->getElementSize(), stream);
+    if (contacts) {
+        // Add the forces of the contact variables, on the same stream so they follow the upload.  Copies from pageable
+        // memory return once the data has been staged, so floatForces may go out of scope.
+
+        vector<float> floatForces;
+        if (useDoubleContactValues)
+            cuMemcpyHtoDAsync(contactVariableForces.getDevicePointer(), contactForces.data(), contactForces.size()*sizeof(double), stream);
+        else {
+            floatForces.assign(contactForces.begin(), contactForces.end());
+            cuMemcpyHtoDAsync(contactVariableForces.getDevicePointer(), floatForces.data(), floatForces.size()*sizeof(float), stream);
+        }
+        void* args[] = {&contactPairDerivatives.getDevicePointer(), &contactPairVariable.getDevicePointer(), &contactAtoms.getDevicePointer(),
+                &contactAtomStart.getDevicePointer(), &contactAtomEntries.getDevicePointer(), &contactVariableForces.getDevicePointer(),
+                &plumedForces->getDevicePointer()};
+        int numBlocks = (contactAtoms.getSize()+127)/128;
+        cuLaunchKernel(addContactForcesKernel, numBlocks, 1, 1, 128, 1, 1, 0, stream, args, NULL);
+    }
+    if (tracing) {
+        cuEventRecord(uploadEvents[1], stream);
+        tracedUpload = true;
+    }
     cuEventRecord(syncEvent, stream);
-    
+    counters[PlumedValueStorage::TransferTime] += chrono::duration<double>(chrono::steady_clock::now()-transferStart).count();
 }
 
 double CudaCalcPlumedForceKernel::addForces(bool includeForces, bool includeEnergy, int groups) {
@@ -266,19 +625,60 @@ double CudaCalcPlumedForceKernel::addForces(bool includeForces, bool includeEner
 
     // Wait until executeOnWorkerThread() is finished.
     
+    PlumedTraceSpan waitSpan("wait for worker thread");
     cu.getWorkThread().flush();
     cuStreamWaitEvent(cu.getCurrentStream(), syncEvent, 0);
+    waitSpan.end();
 
     // Add in the forces.
     
+    PlumedTraceSpan span("addForces");
     if (includeForces) {
         void* args[] = {&plumedForces->getDevicePointer(), &cu.getForce().getDevicePointer(), &cu.getAtomIndexArray().getDevicePointer()};
+        if (tracing)
+            cuEventRecord(addForcesEvents[0], cu.getCurrentStream());
         cu.executeKernel(addForcesKernel, args, cu.getNumAtoms());
+        if (tracing) {
+            cuEventRecord(addForcesEvents[1], cu.getCurrentStream());
+            tracedAddForces = true;
+        }
     }
     
     // Return the energy.
     
-    double energy = 0;
-    plumed_cmd(plumedmain, "getBias", &energy);
-    return energy;
+    if (!metadynamics)
+        plumedmain.cmd("getBias", &storage->getBias());
+    return storage->getBias();
+}
+
+void CudaCalcPlumedForceKernel::recordDeviceSpans() {
+    // By the start of the next step the events have long completed, so waiting for them costs nothing.
+
+    float startTime, endTime;
+    if (tracedUpload) {
+        cuEventSynchronize(uploadEvents[1]);
+        cuEventElapsedTime(&startTime, traceOriginEvent, uploadEvents[0]);
+        cuEventElapsedTime(&endTime, traceOriginEvent, uploadEvents[1]);
+        PlumedTracer::addDeviceSpan("upload forces", "CUDA PLUMED stream", traceOrigin+(long long) (1e6*startTime), traceOrigin+(long long) (1e6*endTime));
+        tracedUpload = false;
+    }
+    if (tracedAddForces) {
+        cuEventSynchronize(addForcesEvents[1]);
+        cuEventElapsedTime(&startTime, traceOriginEvent, addForcesEvents[0]);
+        cuEventElapsedTime(&endTime, traceOriginEvent, addForcesEvents[1]);
+        PlumedTracer::addDeviceSpan("addForces", "CUDA compute stream", traceOrigin+(long long) (1e6*startTime), traceOrigin+(long long) (1e6*endTime));
+        tracedAddForces = false;
+    }
+}
+
+void CudaCalcPlumedForceKernel::getCollectiveVariableValues(vector<double>& values) const {
+    values.assign(storage->getValues(), storage->getValues()+storage->getNumValues());
+}
+
+double CudaCalcPlumedForceKernel::getBiasEnergy() const {
+    return storage->getBias();
+}
+
+shared_ptr<PlumedValueStorage> CudaCalcPlumedForceKernel::getValueStorage() const {
+    return storage;
 }
@@ -0,0 +1,130 @@
+/**
+ * Copy the positions of the atoms to an array in their original order.
+ */
+extern "C" __global__ void gatherContactPositions(const real4* __restrict__ posq, const int* __restrict__ atomIndex, real4* __restrict__ positions) {
+    for (int atom = blockIdx.x*blockDim.x+threadIdx.x; atom < NUM_ATOMS; atom += blockDim.x*gridDim.x)
+        positions[atomIndex[atom]] = posq[atom];
+}
+
+/**
+ * Compute the switching function of every pair, and its derivative with respect to the position of the second atom.
+ * This matches PlumedContactVariables::computeValues().
+ */
+extern "C" __global__ void computeContactPairs(const real4* __restrict__ positions, const int2* __restrict__ pairAtoms,
+        const real* __restrict__ pairParameters, real* __restrict__ pairValues, real4* __restrict__ pairDerivatives,
+        real4 boxVecX, real4 boxVecY, real4 boxVecZ, int triclinic) {
+    for (int pair = blockIdx.x*blockDim.x+threadIdx.x; pair < NUM_PAIRS; pair += blockDim.x*gridDim.x) {
+        const real* p = &pairParameters[pair*NUM_PARAMETERS];
+        int2 atoms = pairAtoms[pair];
+        real4 pos1 = positions[atoms.x];
+        real4 pos2 = positions[atoms.y];
+        real dx = pos2.x-pos1.x, dy = pos2.y-pos1.y, dz = pos2.z-pos1.z;
+        if (p[PARAMETER_PERIODIC] != 0) {
+            real scale = floor(dz/boxVecZ.z+(real) 0.5);
+            dx -= scale*boxVecZ.x;
+            dy -= scale*boxVecZ.y;
+            dz -= scale*boxVecZ.z;
+            scale = floor(dy/boxVecY.y+(real) 0.5);
+            dx -= scale*boxVecY.x;
+            dy -= scale*boxVecY.y;
+            scale = floor(dx/boxVecX.x+(real) 0.5);
+            dx -= scale*boxVecX.x;
+            if (triclinic) {
+                real bestX = dx, bestY = dy, bestZ = dz, bestR2 = dx*dx+dy*dy+dz*dz;
+                for (int i = -1; i <= 1; i++)
+                    for (int j = -1; j <= 1; j++)
+                        for (int k = -1; k <= 1; k++) {
+                            real x = dx+i*boxVecX.x+j*boxVecY.x+k*boxVecZ.x;
+                            real y = dy+j*boxVecY.y+k*boxVecZ.y;
+                            real z = dz+k*boxVecZ.z;
+                            real r2 = x*x+y*y+z*z;
+                            if (r2 < bestR2) {
+                                bestR2 = r2;
+                                bestX = x;
+                                bestY = y;
+                                bestZ = z;
+                            }
+                        }
+                dx = bestX;
+                dy = bestY;
+                dz = bestZ;
+            }
+        }
+        real r = sqrt(dx*dx+dy*dy+dz*dz);
+        real value = 0, dfunc = 0;
+        if (r <= p[PARAMETER_DMAX]) {
+            real x = (r-p[PARAMETER_D0])*p[PARAMETER_INVR0];
+            value = 1;
+            if (x > 0) {
+                real nn = p[PARAMETER_NN], mm = p[PARAMETER_MM];
+                if (fabs(x-1) < SWITCH_EPSILON) {
+                    value = nn/mm;
+                    dfunc = (real) 0.5*nn*(nn-mm)/mm;
+                }
+                else {
+                    real xn = pow(x, nn-1), xm = pow(x, mm-1);
+                    real numerator = 1-xn*x, denominator = 1-xm*x;
+                    value = numerator/denominator;
+                    dfunc = (-nn*xn*denominator+mm*xm*numerator)/(denominator*denominator);
+                }
+                dfunc *= p[PARAMETER_INVR0];
+            }
+            value = value*p[PARAMETER_STRETCH]+p[PARAMETER_SHIFT];
+            dfunc *= p[PARAMETER_STRETCH];
+            if (r > 0)
+                dfunc /= r;
+        }
+        pairValues[pair] = value*p[PARAMETER_WEIGHT];
+        dfunc *= p[PARAMETER_WEIGHT];
+        pairDerivatives[pair] = make_real4(dfunc*dx, dfunc*dy, dfunc*dz, 0);
+    }
+}
+
+/**
+ * Sum the values of the pairs of each variable.  Each thread block handles one variable at a time.
+ */
+extern "C" __global__ void sumContactVariables(const real* __restrict__ pairValues, const int* __restrict__ variableStart, mixed* __restrict__ values) {
+    __shared__ mixed sum[CONTACT_BLOCK_SIZE];
+    for (int variable = blockIdx.x; variable < NUM_CONTACT_VARIABLES; variable += gridDim.x) {
+        mixed partial = 0;
+        for (int pair = variableStart[variable]+threadIdx.x; pair < variableStart[variable+1]; pair += blockDim.x)
+            partial += pairValues[pair];
+        sum[threadIdx.x] = partial;
+        __syncthreads();
+        for (int offset = blockDim.x/2; offset > 0; offset /= 2) {
+            if (threadIdx.x < offset)
+                sum[threadIdx.x] += sum[threadIdx.x+offset];
+            __syncthreads();
+        }
+        if (threadIdx.x == 0)
+            values[variable] = sum[0];
+        __syncthreads();
+    }
+}
+
+/**
+ * Apply the forces PLUMED computed on the variables to the atoms, adding them to the forces uploaded from PLUMED.
+ * Each thread sums all the pairs of one atom, so no atomic operations are needed.
+ */
+extern "C" __global__ void addContactForces(const real4* __restrict__ pairDerivatives, const int* __restrict__ pairVariable,
+        const int* __restrict__ contactAtoms, const int* __restrict__ atomStart, const int* __restrict__ atomEntries,
+        const mixed* __restrict__ variableForces, real* __restrict__ forces) {
+    for (int i = blockIdx.x*blockDim.x+threadIdx.x; i < NUM_CONTACT_ATOMS; i += blockDim.x*gridDim.x) {
+        real fx = 0, fy = 0, fz = 0;
+        for (int j = atomStart[i]; j < atomStart[i+1]; j++) {
+            int entry = atomEntries[j];
+            int pair = entry/2;
+            real scale = (real) variableForces[pairVariable[pair]];
+            if ((entry&1) == 0)
+                scale = -scale;
+            real4 derivative = pairDerivatives[pair];
+            fx += scale*derivative.x;
+            fy += scale*derivative.y;
+            fz += scale*derivative.z;
+        }
+        int atom = contactAtoms[i];
+        forces[3*atom] += fx;
+        forces[3*atom+1] += fy;
+        forces[3*atom+2] += fz;
+    }
+}
@@ -8,3 +8,32 @@ void addForces(const real* __restrict__ forces, long long* __restrict__ forceBuf
     }
 }
 
+
+/**
+ * Record the index in the sorted arrays of every atom.
+ */
+extern "C" __global__
+void invertAtomIndex(const int* __restrict__ atomIndex, int* __restrict__ sortedIndex) {
+    for (int atom = blockIdx.x*blockDim.x+threadIdx.x; atom < NUM_ATOMS; atom += blockDim.x*gridDim.x)
+        sortedIndex[atomIndex[atom]] = atom;
+}
+
+/**
+ * Copy the positions of a list of atoms, given by their indices in the System, to a compact array.  The sorted
+ * index of each one is recorded so the host can apply its periodic cell offset.
+ */
+extern "C" __global__
+void gatherPositions(const real4* __restrict__ posq, const real4* __restrict__ posqCorrection, const int* __restrict__ sortedIndex,
+        const int* __restrict__ atoms, int numAtoms, mixed4* __restrict__ positions, int* __restrict__ atomSortedIndex) {
+    for (int i = blockIdx.x*blockDim.x+threadIdx.x; i < numAtoms; i += blockDim.x*gridDim.x) {
+        int index = sortedIndex[atoms[i]];
+        real4 pos = posq[index];
+#ifdef USE_MIXED_PRECISION
+        real4 correction = posqCorrection[index];
+        positions[i] = make_mixed4(pos.x+(mixed) correction.x, pos.y+(mixed) correction.y, pos.z+(mixed) correction.z, 0);
+#else
+        positions[i] = make_mixed4(pos.x, pos.y, pos.z, 0);
+#endif
+        atomSortedIndex[i] = index;
+    }
+}
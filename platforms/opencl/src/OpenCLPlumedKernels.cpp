@@ -32,12 +32,18 @@
 #include <mpi.h>
 #include "OpenCLPlumedKernels.h"
 #include "OpenCLPlumedKernelSources.h"
-#include "openmm/NonbondedForce.h"
+#include "internal/PlumedForceImpl.h"
+#include "internal/PlumedHardwareCounters.h"
+#include "internal/PlumedForcePacking.h"
+#include "internal/PlumedThreadLimit.h"
+#include "internal/PlumedTracer.h"
 #include "openmm/internal/ContextImpl.h"
 #include "openmm/opencl/OpenCLBondedUtilities.h"
 #include "openmm/opencl/OpenCLForceInfo.h"
 #include "openmm/reference/SimTKOpenMMRealType.h"
+#include <chrono>
 #include <cstring>
+#include <limits>
 #include <map>
 
 using namespace PlumedPlugin;
@@ -59,6 +65,8 @@ public:
     ExecuteTask(OpenCLCalcPlumedForceKernel& owner) : owner(owner) {
     }
     void execute() {
+        PlumedTracer::setThreadName("OpenMM worker thread");
+        PlumedTraceSpan span("ExecuteTask");
         owner.executeOnWorkerThread();
     }
     OpenCLCalcPlumedForceKernel& owner;
@@ -75,89 +83,315 @@ public:
 };
 
 OpenCLCalcPlumedForceKernel::~OpenCLCalcPlumedForceKernel() {
+    if (coordinateExport)
+        coordinateExport->removeClient(exportClient);
     if (plumedForces != NULL)
         delete plumedForces;
-    if (hasInitialized)
-        plumed_finalize(plumedmain);
+    if (pinnedBuffer != NULL) {
+        cl.getQueue().enqueueUnmapMemObject(*pinnedBuffer, pinnedMemory);
+        delete pinnedBuffer;
+    }
+    if (hasInitialized) {
+        lock_guard<mutex> guard(PlumedForceImpl::getInitializationLock());
+        plumedmain.finalize();
+    }
 }
 
 void OpenCLCalcPlumedForceKernel::initialize(const System& system, const PlumedForce& force) {
     int elementSize = (cl.getUseDoublePrecision() ? sizeof(double) : sizeof(float));
     plumedForces = new OpenCLArray(cl, 3*system.getNumParticles(), elementSize, "plumedForces");
+    int bufferSize = plumedForces->getSize()*elementSize;
+    pinnedBuffer = new cl::Buffer(cl.getContext(), CL_MEM_ALLOC_HOST_PTR, bufferSize);
+    pinnedMemory = cl.getQueue().enqueueMapBuffer(*pinnedBuffer, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0, bufferSize);
     map<string, string> defines;
     defines["NUM_ATOMS"] = cl.intToString(cl.getNumAtoms());
     defines["PADDED_NUM_ATOMS"] = cl.intToString(cl.getPaddedNumAtoms());
     cl::Program program = cl.createProgram(OpenCLPlumedKernelSources::plumedForce, defines);
     addForcesKernel = cl::Kernel(program, "addForces");
+    int mixedSize = (cl.getUseDoublePrecision() || cl.getUseMixedPrecision() ? sizeof(double) : sizeof(float));
+    exportSortedIndex.initialize<int>(cl, system.getNumParticles(), "exportSortedIndex");
+    exportAtoms.initialize<int>(cl, system.getNumParticles(), "exportAtoms");
+    exportPositions.initialize(cl, system.getNumParticles(), 4*mixedSize, "exportPositions");
+    exportAtomSortedIndex.initialize<int>(cl, system.getNumParticles(), "exportAtomSortedIndex");
+    invertAtomIndexKernel = cl::Kernel(program, "invertAtomIndex");
+    invertAtomIndexKernel.setArg<cl::Buffer>(0, cl.getAtomIndexArray().getDeviceBuffer());
+    invertAtomIndexKernel.setArg<cl::Buffer>(1, exportSortedIndex.getDeviceBuffer());
+    gatherPositionsKernel = cl::Kernel(program, "gatherPositions");
+    gatherPositionsKernel.setArg<cl::Buffer>(0, cl.getPosq().getDeviceBuffer());
+    gatherPositionsKernel.setArg<cl::Buffer>(1, cl.getUseMixedPrecision() ? cl.getPosqCorrection().getDeviceBuffer() : cl.getPosq().getDeviceBuffer());
+    gatherPositionsKernel.setArg<cl::Buffer>(2, exportSortedIndex.getDeviceBuffer());
+    gatherPositionsKernel.setArg<cl::Buffer>(3, exportAtoms.getDeviceBuffer());
+    gatherPositionsKernel.setArg<cl::Buffer>(5, exportPositions.getDeviceBuffer());
+    gatherPositionsKernel.setArg<cl::Buffer>(6, exportAtomSortedIndex.getDeviceBuffer());
+    coordinateExport = PlumedCoordinateExport::acquire(contextImpl);
+    exportClient = coordinateExport->addClient();
     forceGroupFlag = (1<<force.getForceGroup());
     cl.addPreComputation(new StartCalculationPreComputation(*this));
     cl.addPostComputation(new AddForcesPostComputation(*this));
 
     // Construct and initialize the PLUMED interface object.
 
-    plumedmain = plumed_create();
+    PlumedTraceSpan span("initialize");
+    lock_guard<mutex> guard(PlumedForceImpl::getInitializationLock());
+    PlumedForceImpl::initializeMPI();
+    const vector<string>& labels = force.getCollectiveVariables();
+    storage.reset(new PlumedValueStorage(labels.size()));
+
+    // Prepare to count hardware events.  Those the system does not allow to count are marked with -1, as are those
+    // of PLUMED's computation when it may run on several threads.
+
+    useHardwareCounters = force.getUseHardwareCounters();
+    deterministic = force.getDeterministic();
+    countCalculationEvents = (useHardwareCounters && (deterministic || PlumedThreadLimit::getDefaultNumThreads() == 1));
+    if (useHardwareCounters) {
+        PlumedHardwareCounters::initializeCounters(storage->getCounters()+PlumedValueStorage::CalculationCycles, countCalculationEvents);
+        PlumedHardwareCounters::initializeCounters(storage->getCounters()+PlumedValueStorage::TransferCycles);
+    }
+
+    // Record the particle masses and charges.  Masses set on the force are shared with it, not copied.
+
+    masses = PlumedForceImpl::getParticleMasses(system, force);
+    charges = PlumedForceImpl::getParticleCharges(system);
+
+    // Which step each computation belongs to depends on when the integrator computes the forces.
+
+    schedule.reset(new PlumedStepSchedule(contextImpl.getIntegrator(), force.getForceGroup()));
+
+    // Metadynamics the plugin supports itself does not need PLUMED at all.  It runs on the worker thread in place
+    // of PLUMED, and its forces are uploaded the same way.
+
+    metadynamics = PlumedMetadynamics::create(force, system, contextImpl.getIntegrator().getStepSize());
+    if (metadynamics) {
+        neededAtoms = metadynamics->getAtoms();
+        return;
+    }
+    plumedmain.create();
+    PlumedTraceSpan mpiSpan("GREX init", "mpi");
+    int intra_comm_rank;
+    MPI_Comm intra_comm = force.getIntracom();
+    MPI_Comm inter_comm = force.getIntercom();
+    MPI_Comm_rank(intra_comm, &intra_comm_rank);
+    if (intra_comm_rank == 0)
+        plumedmain.cmd("GREX setMPIIntercomm", &inter_comm);
+    plumedmain.cmd("GREX setMPIIntracomm", &intra_comm);
+    plumedmain.cmd("GREX init");
+    plumedmain.cmd("setMPIComm", &intra_comm);
+    mpiSpan.end();
+    if (force.getLoadBalanceReportInterval() > 0 && intra_comm_rank == 0)
+        loadBalance.reset(new PlumedLoadBalanceMonitor(inter_comm, force.getLoadBalanceReportInterval(), force.getLoadBalanceReportFile()));
     hasInitialized = true;
     int apiVersion;
-    plumed_cmd(plumedmain, "getApiVersion", &apiVersion);
+    plumedmain.cmd("getApiVersion", &apiVersion);
     if (apiVersion < 4)
         throw OpenMMException("Unsupported API version.  Upgrade PLUMED to a newer version.");
     int precision = 8;
-    plumed_cmd(plumedmain, "setRealPrecision", &precision);
+    plumedmain.cmd("setRealPrecision", &precision);
     double conversion = 1.0;
-    plumed_cmd(plumedmain, "setMDEnergyUnits", &conversion);
-    plumed_cmd(plumedmain, "setMDLengthUnits", &conversion);
-    plumed_cmd(plumedmain, "setMDTimeUnits", &conversion);
-    plumed_cmd(plumedmain, "setMDEngine", "OpenMM");
-    plumed_cmd(plumedmain, "setLog", force.getLogStream());
+    plumedmain.cmd("setMDEnergyUnits", &conversion);
+    plumedmain.cmd("setMDLengthUnits", &conversion);
+    plumedmain.cmd("setMDTimeUnits", &conversion);
+    plumedmain.cmd("setMDEngine", "OpenMM");
+    logStream = force.getSharedLogStream();
+    plumedmain.cmd("setLog", logStream.get());
     int numParticles = system.getNumParticles();
-    plumed_cmd(plumedmain, "setNatoms", &numParticles);
+    plumedmain.cmd("setNatoms", &numParticles);
     double dt = contextImpl.getIntegrator().getStepSize();
-    plumed_cmd(plumedmain, "setTimestep", &dt);
+    plumedmain.cmd("setTimestep", &dt);
     double kT = force.getTemperature() * BOLTZ;
     if (kT >= 0.0)
-        plumed_cmd(plumedmain, "setKbT", &kT);
+        plumedmain.cmd("setKbT", &kT);
     int restart = force.getRestart();
-    plumed_cmd(plumedmain, "setRestart", &restart);
-    plumed_cmd(plumedmain, "setMPIComm", force.getMPI());
-    plumed_cmd(plumedmain, "init", NULL);
+    plumedmain.cmd("setRestart", &restart);
+    plumedmain.cmd("init");
+
+    // COORDINATION and CONTACTMAP actions the plugin computes itself are replaced by EXTRACV in the script.
+
+    contacts = PlumedContactVariables::create(force, system);
+    const string& script = (contacts ? contacts->getScript() : force.getScript());
+    if (contacts) {
+        contactValues.resize(contacts->getNumVariables());
+        contactForces.resize(contacts->getNumVariables());
+        initializeContacts();
+    }
     if(apiVersion > 7) {
-        plumed_cmd(plumedmain, "readInputLines", force.getScript().c_str());
+        plumedmain.cmd("readInputLines", script.c_str());
     } else {
         // NOTE: the comments and line continuation does not works
         //       (https://github.com/plumed/plumed2/issues/571)
         // TODO: remove this when PLUMED 2.6 support is dropped
-        vector<char> scriptChars(force.getScript().size()+1);
-        strcpy(&scriptChars[0], force.getScript().c_str());
+        vector<char> scriptChars(script.size()+1);
+        strcpy(&scriptChars[0], script.c_str());
         char* line = strtok(&scriptChars[0], "\r\n");
         while (line != NULL) {
-            plumed_cmd(plumedmain, "readInputLine", line);
+            plumedmain.cmd("readInputLine", line);
             line = strtok(NULL, "\r\n");
         }
     }
     usesPeriodic = system.usesPeriodicBoundaryConditions();
 
-    // Record the particle masses.
+    // Results may only be reused if no other replica takes part in the calculation.
 
-    masses.resize(numParticles);
-    const auto& plumedMasses = force.getMasses();
-    if (plumedMasses.size() == 0) // User System masses
-        for (int i = 0; i < numParticles; i++)
-            masses[i] = system.getParticleMass(i);
-    else if (plumedMasses.size() == numParticles) // User PLUMED masses
-        masses = plumedMasses;
-    else
-        throw OpenMMException("The number of PLUMED masses is different from the number of particles!");
+    int numReplicas = 1;
+    if (intra_comm_rank == 0)
+        MPI_Comm_size(inter_comm, &numReplicas);
+    MPI_Bcast(&numReplicas, 1, MPI_INT, 0, intra_comm);
+    if (force.getReuseTolerance() > 0 && numReplicas == 1 && !contacts)
+        reuse.reset(new PlumedReuseCheck(force.getReuseTolerance(), force.getScript()));
 
-    // If there's a NonbondedForce, get charges from it.
+    // Ask PLUMED to store the requested values every time it computes them.
 
-    for (int j = 0; j < system.getNumForces(); j++) {
-        const NonbondedForce* nonbonded = dynamic_cast<const NonbondedForce*>(&system.getForce(j));
-        if (nonbonded != NULL) {
-            charges.resize(numParticles);
-            double sigma, epsilon;
-            for (int i = 0; i < numParticles; i++)
-                nonbonded->getParticleParameters(i, charges[i], sigma, epsilon);
-        }
+    for (int i = 0; i < labels.size(); i++)
+        plumedmain.cmd(("setMemoryForData "+labels[i]).c_str(), storage->getValues()+i);
+}
+
+void OpenCLCalcPlumedForceKernel::initializeContacts() {
+    int numVariables = contacts->getNumVariables();
+    const vector<int>& variableStart = contacts->getVariableStart();
+    int numPairs = variableStart[numVariables];
+    vector<int> pairVariable(numPairs), atoms, atomStart, atomEntries;
+    for (int i = 0; i < numVariables; i++)
+        for (int j = variableStart[i]; j < variableStart[i+1]; j++)
+            pairVariable[j] = i;
+    contacts->getAtomPairs(atoms, atomStart, atomEntries);
+
+    // Copy the pairs and their parameters to the device.  In single precision the parameters are converted to
+    // float, clamping the infinite cutoff of switching functions without D_MAX.
+
+    bool useDouble = cl.getUseDoublePrecision();
+    useDoubleContactValues = (useDouble || cl.getUseMixedPrecision());
+    int realSize = (useDouble ? sizeof(double) : sizeof(float));
+    int mixedSize = (useDoubleContactValues ? sizeof(double) : sizeof(float));
+    const vector<double>& parameters = contacts->getPairParameters();
+    contactPositions.initialize(cl, cl.getNumAtoms(), 4*realSize, "contactPositions");
+    contactPairAtoms.initialize(cl, numPairs, 2*sizeof(int), "contactPairAtoms");
+    contactPairParameters.initialize(cl, parameters.size(), realSize, "contactPairParameters");
+    contactPairValues.initialize(cl, numPairs, realSize, "contactPairValues");
+    contactPairDerivatives.initialize(cl, numPairs, 4*realSize, "contactPairDerivatives");
+    contactVariableStart.initialize<int>(cl, numVariables+1, "contactVariableStart");
+    contactPairVariable.initialize<int>(cl, numPairs, "contactPairVariable");
+    contactAtoms.initialize<int>(cl, atoms.size(), "contactAtoms");
+    contactAtomStart.initialize<int>(cl, atomStart.size(), "contactAtomStart");
+    contactAtomEntries.initialize<int>(cl, atomEntries.size(), "contactAtomEntries");
+    contactVariableValues.initialize(cl, numVariables, mixedSize, "contactVariableValues");
+    contactVariableForces.initialize(cl, numVariables, mixedSize, "contactVariableForces");
+    contactPairAtoms.upload(contacts->getPairAtoms().data());
+    if (useDouble)
+        contactPairParameters.upload(parameters.data());
+    else {
+        vector<float> floatParameters(parameters.size());
+        for (int i = 0; i < parameters.size(); i++)
+            floatParameters[i] = (float) min(parameters[i], (double) numeric_limits<float>::max());
+        contactPairParameters.upload(floatParameters);
+    }
+    contactVariableStart.upload(variableStart);
+    contactPairVariable.upload(pairVariable);
+    contactAtoms.upload(atoms);
+    contactAtomStart.upload(atomStart);
+    contactAtomEntries.upload(atomEntries);
+
+    // Create the kernels.
+
+    map<string, string> defines;
+    defines["NUM_ATOMS"] = cl.intToString(cl.getNumAtoms());
+    defines["NUM_PAIRS"] = cl.intToString(numPairs);
+    defines["NUM_CONTACT_VARIABLES"] = cl.intToString(numVariables);
+    defines["NUM_CONTACT_ATOMS"] = cl.intToString(atoms.size());
+    defines["CONTACT_BLOCK_SIZE"] = "128";
+    defines["NUM_PARAMETERS"] = cl.intToString(PlumedContactVariables::NumParameters);
+    defines["PARAMETER_INVR0"] = cl.intToString(PlumedContactVariables::InvR0);
+    defines["PARAMETER_D0"] = cl.intToString(PlumedContactVariables::D0);
+    defines["PARAMETER_NN"] = cl.intToString(PlumedContactVariables::NN);
+    defines["PARAMETER_MM"] = cl.intToString(PlumedContactVariables::MM);
+    defines["PARAMETER_DMAX"] = cl.intToString(PlumedContactVariables::DMax);
+    defines["PARAMETER_STRETCH"] = cl.intToString(PlumedContactVariables::Stretch);
+    defines["PARAMETER_SHIFT"] = cl.intToString(PlumedContactVariables::Shift);
+    defines["PARAMETER_WEIGHT"] = cl.intToString(PlumedContactVariables::Weight);
+    defines["PARAMETER_PERIODIC"] = cl.intToString(PlumedContactVariables::Periodic);
+    defines["SWITCH_EPSILON"] = cl.doubleToString(100*(useDouble ? numeric_limits<double>::epsilon() : numeric_limits<float>::epsilon()));
+    cl::Program program = cl.createProgram(OpenCLPlumedKernelSources::contactVariables, defines);
+    gatherContactPositionsKernel = cl::Kernel(program, "gatherContactPositions");
+    gatherContactPositionsKernel.setArg<cl::Buffer>(0, cl.getPosq().getDeviceBuffer());
+    gatherContactPositionsKernel.setArg<cl::Buffer>(1, cl.getAtomIndexArray().getDeviceBuffer());
+    gatherContactPositionsKernel.setArg<cl::Buffer>(2, contactPositions.getDeviceBuffer());
+    computeContactPairsKernel = cl::Kernel(program, "computeContactPairs");
+    computeContactPairsKernel.setArg<cl::Buffer>(0, contactPositions.getDeviceBuffer());
+    computeContactPairsKernel.setArg<cl::Buffer>(1, contactPairAtoms.getDeviceBuffer());
+    computeContactPairsKernel.setArg<cl::Buffer>(2, contactPairParameters.getDeviceBuffer());
+    computeContactPairsKernel.setArg<cl::Buffer>(3, contactPairValues.getDeviceBuffer());
+    computeContactPairsKernel.setArg<cl::Buffer>(4, contactPairDerivatives.getDeviceBuffer());
+    sumContactVariablesKernel = cl::Kernel(program, "sumContactVariables");
+    sumContactVariablesKernel.setArg<cl::Buffer>(0, contactPairValues.getDeviceBuffer());
+    sumContactVariablesKernel.setArg<cl::Buffer>(1, contactVariableStart.getDeviceBuffer());
+    sumContactVariablesKernel.setArg<cl::Buffer>(2, contactVariableValues.getDeviceBuffer());
+    addContactForcesKernel = cl::Kernel(program, "addContactForces");
+    addContactForcesKernel.setArg<cl::Buffer>(0, contactPairDerivatives.getDeviceBuffer());
+    addContactForcesKernel.setArg<cl::Buffer>(1, contactPairVariable.getDeviceBuffer());
+    addContactForcesKernel.setArg<cl::Buffer>(2, contactAtoms.getDeviceBuffer());
+    addContactForcesKernel.setArg<cl::Buffer>(3, contactAtomStart.getDeviceBuffer());
+    addContactForcesKernel.setArg<cl::Buffer>(4, contactAtomEntries.getDeviceBuffer());
+    addContactForcesKernel.setArg<cl::Buffer>(5, contactVariableForces.getDeviceBuffer());
+    addContactForcesKernel.setArg<cl::Buffer>(6, plumedForces->getDeviceBuffer());
+}
+
+void OpenCLCalcPlumedForceKernel::transferPositions(const vector<int>& atoms, bool allAtoms, vector<Vec3>& result) {
+    if (allAtoms) {
+        contextImpl.getPositions(result);
+        return;
+    }
+
+    // Gather the atoms on the device and download only them.
+
+    int numAtoms = atoms.size();
+    exportAtoms.uploadSubArray(atoms.data(), 0, numAtoms);
+    cl.executeKernel(invertAtomIndexKernel, cl.getNumAtoms());
+    gatherPositionsKernel.setArg<cl_int>(4, numAtoms);
+    cl.executeKernel(gatherPositionsKernel, numAtoms);
+    downloadedSortedIndex.resize(numAtoms);
+    cl.getQueue().enqueueReadBuffer(exportAtomSortedIndex.getDeviceBuffer(), CL_FALSE, 0, numAtoms*sizeof(int), downloadedSortedIndex.data());
+    if (exportPositions.getElementSize() == 4*sizeof(double)) {
+        downloadedPositions.resize(4*numAtoms);
+        cl.getQueue().enqueueReadBuffer(exportPositions.getDeviceBuffer(), CL_TRUE, 0, numAtoms*exportPositions.getElementSize(), downloadedPositions.data());
+    }
+    else {
+        vector<float> floatPositions(4*numAtoms);
+        cl.getQueue().enqueueReadBuffer(exportPositions.getDeviceBuffer(), CL_TRUE, 0, numAtoms*exportPositions.getElementSize(), floatPositions.data());
+        downloadedPositions.assign(floatPositions.begin(), floatPositions.end());
+    }
+
+    // Undo the periodic wrapping the same way ContextImpl::getPositions() does.
+
+    Vec3 boxVectors[3];
+    cl.getPeriodicBoxVectors(boxVectors[0], boxVectors[1], boxVectors[2]);
+    const vector<mm_int4>& offsets = cl.getPosCellOffsets();
+    for (int i = 0; i < numAtoms; i++) {
+        const mm_int4& offset = offsets[downloadedSortedIndex[i]];
+        Vec3 pos(downloadedPositions[4*i], downloadedPositions[4*i+1], downloadedPositions[4*i+2]);
+        result[atoms[i]] = pos-boxVectors[0]*offset.x-boxVectors[1]*offset.y-boxVectors[2]*offset.z;
+    }
+}
+
+void OpenCLCalcPlumedForceKernel::computeContacts() {
+    int numVariables = contacts->getNumVariables();
+    cl.executeKernel(gatherContactPositionsKernel, cl.getNumAtoms());
+    if (cl.getUseDoublePrecision()) {
+        computeContactPairsKernel.setArg<mm_double4>(5, cl.getPeriodicBoxVecXDouble());
+        computeContactPairsKernel.setArg<mm_double4>(6, cl.getPeriodicBoxVecYDouble());
+        computeContactPairsKernel.setArg<mm_double4>(7, cl.getPeriodicBoxVecZDouble());
+    }
+    else {
+        computeContactPairsKernel.setArg<mm_float4>(5, cl.getPeriodicBoxVecX());
+        computeContactPairsKernel.setArg<mm_float4>(6, cl.getPeriodicBoxVecY());
+        computeContactPairsKernel.setArg<mm_float4>(7, cl.getPeriodicBoxVecZ());
+    }
+    computeContactPairsKernel.setArg<cl_int>(8, cl.getBoxIsTriclinic() ? 1 : 0);
+    cl.executeKernel(computeContactPairsKernel, contactPairValues.getSize());
+    cl.executeKernel(sumContactVariablesKernel, numVariables*128, 128);
+    if (useDoubleContactValues)
+        contactVariableValues.download(contactValues.data());
+    else {
+        vector<float> values(numVariables);
+        contactVariableValues.download(values.data());
+        contactValues.assign(values.begin(), values.end());
     }
 }
 
@@ -168,67 +402,186 @@ double OpenCLCalcPlumedForceKernel::execute(ContextImpl& context, bool includeFo
     return 0;
 }
 
+void OpenCLCalcPlumedForceKernel::beginStep(ContextImpl& context) {
+    schedule->beginStep(context.getStepCount());
+}
+
 void OpenCLCalcPlumedForceKernel::beginComputation(bool includeForces, bool includeEnergy, int groups) {
     if ((groups&forceGroupFlag) == 0)
         return;
-    contextImpl.getPositions(positions);
+    int stepCount = cl.getStepCount();
+    bool positionsChanged = false;
+    if (schedule->needsPositionCheck(stepCount) && checkedAtoms.size() > 0) {
+        // Compare the atoms the previous computation used, which are still in neededAtoms, to tell whether the
+        // integrator moved the particles before this computation.  The transfer also serves this computation, which
+        // usually needs the same atoms.
+
+        getNeededPositions();
+        for (int i = 0; i < checkedAtoms.size() && !positionsChanged; i++)
+            positionsChanged = (positions[checkedAtoms[i]] != checkedPositions[i]);
+    }
+    step = schedule->getStep(stepCount, positionsChanged, update);
+    update = (update && step != lastStepIndex);
+    if (update)
+        lastStepIndex = step;
+    if (!metadynamics) {
+        // Ask PLUMED which atoms the actions active at this step use.  The worker thread then only needs to share
+        // the data, since the dependencies are already prepared.
+
+        PlumedTraceSpan span("prepareDependencies", "plumed");
+        plumedmain.cmd("setStep", &step);
+        plumedmain.cmd("prepareDependencies");
+        int numAtoms;
+        const int* atoms;
+        plumedmain.cmd("createFullList", &numAtoms);
+        plumedmain.cmd("getFullList", &atoms);
+        neededAtoms.assign(atoms, atoms+numAtoms);
+        plumedmain.cmd("clearFullList");
+    }
+    getNeededPositions();
+    if (schedule->getComputationsAfterMoving() > 0) {
+        checkedAtoms = neededAtoms;
+        checkedPositions.resize(neededAtoms.size());
+        for (int i = 0; i < neededAtoms.size(); i++)
+            checkedPositions[i] = positions[neededAtoms[i]];
+    }
+    if (reuse) {
+        // If the atoms barely moved since PLUMED last computed the bias, addForces() adds the same forces again, which
+        // are still on the device, and PLUMED is only updated.
+
+        Vec3 boxVectors[3];
+        contextImpl.getPeriodicBoxVectors(boxVectors[0], boxVectors[1], boxVectors[2]);
+        if (reuse->canReuse(neededAtoms, positions, usesPeriodic ? boxVectors : NULL, step)) {
+            if (update) {
+                PlumedTraceSpan span("update", "plumed");
+                PlumedThreadLimit threadLimit(plumedmain, deterministic);
+                plumedmain.cmd("update");
+                reuse->updated();
+            }
+            storage->getCounters()[PlumedValueStorage::ReusedCalculations]++;
+            return;
+        }
+        reuse->record(neededAtoms, positions, usesPeriodic ? boxVectors : NULL, step);
+
+        // The worker thread updates PLUMED after this computation, which may change the bias.
+
+        if (update)
+            reuse->updated();
+    }
+    if (contacts) {
+        auto contactsStart = chrono::steady_clock::now();
+        computeContacts();
+        storage->getCounters()[PlumedValueStorage::TransferTime] += chrono::duration<double>(chrono::steady_clock::now()-contactsStart).count();
+    }
     
     // The actual force computation will be done on a different thread.
     
     cl.getWorkThread().addTask(new ExecuteTask(*this));
 }
 
+void OpenCLCalcPlumedForceKernel::getNeededPositions() {
+    PlumedTraceSpan span("getPositions");
+    auto transferStart = chrono::steady_clock::now();
+    bool allAtoms = (neededAtoms.size() == contextImpl.getSystem().getNumParticles());
+    positions = coordinateExport->getPositions(exportClient, cl.getComputeForceCount(), neededAtoms, allAtoms,
+            [this] (const vector<int>& atoms, bool allAtoms, vector<Vec3>& result) {transferPositions(atoms, allAtoms, result);}).data();
+    storage->getCounters()[PlumedValueStorage::TransferTime] += chrono::duration<double>(chrono::steady_clock::now()-transferStart).count();
+}
+
 void OpenCLCalcPlumedForceKernel::executeOnWorkerThread() {
     // Configure the PLUMED interface object.
     
     int numParticles = contextImpl.getSystem().getNumParticles();
-    int step = cl.getStepCount();
-    plumed_cmd(plumedmain, "setStep", &step);
-    plumed_cmd(plumedmain, "setMasses", &masses[0]);
-    if (charges.size() > 0)
-        plumed_cmd(plumedmain, "setCharges", &charges[0]);
-    plumed_cmd(plumedmain, "setPositions", &positions[0][0]);
     forces.resize(numParticles);
     memset(&forces[0], 0, numParticles*sizeof(Vec3));
-    plumed_cmd(plumedmain, "setForces", &forces[0][0]);
+    double* counters = storage->getCounters();
+    if (metadynamics) {
+        auto calcStart = chrono::steady_clock::now();
+        PlumedHardwareCounterScope calcEvents(countCalculationEvents ? counters+PlumedValueStorage::CalculationCycles : NULL);
+        storage->getBias() = metadynamics->calcForcesAndEnergy(&positions[0][0], &forces[0][0], step, update);
+        if (update)
+            metadynamics->getRecordedValues(storage->getValues());
+        calcEvents.end();
+        counters[PlumedValueStorage::NumCalculations]++;
+        counters[PlumedValueStorage::CalculationTime] += chrono::duration<double>(chrono::steady_clock::now()-calcStart).count();
+        uploadForces();
+        return;
+    }
+    plumedmain.cmd("setMasses", masses->data());
+    if (charges.size() > 0)
+        plumedmain.cmd("setCharges", &charges[0]);
+    plumedmain.cmd("setPositions", &positions[0][0]);
+    plumedmain.cmd("setForces", &forces[0][0]);
     if (usesPeriodic) {
         Vec3 boxVectors[3];
         contextImpl.getPeriodicBoxVectors(boxVectors[0], boxVectors[1], boxVectors[2]);
-        plumed_cmd(plumedmain, "setBox", &boxVectors[0][0]);
+        plumedmain.cmd("setBox", &boxVectors[0][0]);
     }
     double virial[9];
-    plumed_cmd(plumedmain, "setVirial", &virial);
+    plumedmain.cmd("setVirial", &virial);
+    if (contacts) {
+        // The values were computed on the device by beginComputation().  PLUMED adds the forces on them to
+        // contactForces, which uploadForces() applies to the atoms.
+
+        for (int i = 0; i < contacts->getNumVariables(); i++) {
+            contactForces[i] = 0.0;
+            plumedmain.cmd(("setExtraCV "+contacts->getVariableName(i)).c_str(), &contactValues[i]);
+            plumedmain.cmd(("setExtraCVForce "+contacts->getVariableName(i)).c_str(), &contactForces[i]);
+        }
+    }
 
     // Calculate the forces and energy.
 
-    plumed_cmd(plumedmain, "prepareCalc", NULL);
-    plumed_cmd(plumedmain, "performCalcNoUpdate", NULL);
-    if (step != lastStepIndex) {
-        plumed_cmd(plumedmain, "update", NULL);
-        lastStepIndex = step;
+    if (loadBalance && update)
+        counters[PlumedValueStorage::ReplicaWaitTime] += loadBalance->synchronize(step);
+    auto calcStart = chrono::steady_clock::now();
+    PlumedHardwareCounterScope calcEvents(countCalculationEvents ? counters+PlumedValueStorage::CalculationCycles : NULL);
+    PlumedThreadLimit threadLimit(plumedmain, deterministic);
+    {
+        PlumedTraceSpan span("shareData", "plumed");
+        plumedmain.cmd("shareData");
+    }
+    if (update) {
+        // performCalc also runs the update and fills the buffers registered with setMemoryForData.
+        PlumedTraceSpan span("performCalc", "plumed");
+        plumedmain.cmd("performCalc");
     }
+    else {
+        PlumedTraceSpan span("performCalcNoUpdate", "plumed");
+        plumedmain.cmd("performCalcNoUpdate");
+    }
+    calcEvents.end();
+    counters[PlumedValueStorage::NumCalculations]++;
+    counters[PlumedValueStorage::CalculationTime] += chrono::duration<double>(chrono::steady_clock::now()-calcStart).count();
     
     // Upload the forces to the device.
     
-    if (cl.getUseDoublePrecision()) {
-        double* buffer = (double*) cl.getPinnedBuffer();
-        for (int i = 0; i < numParticles; ++i) {
-            const Vec3& p = forces[i];
-            buffer[3*i] = p[0];
-            buffer[3*i+1] = p[1];
-            buffer[3*i+2] = p[2];
-        }
-    }
-    else {
-        float* buffer = (float*) cl.getPinnedBuffer();
-        for (int i = 0; i < numParticles; ++i) {
-            const Vec3& p = forces[i];
-            buffer[3*i] = (float) p[0];
-            buffer[3*i+1] = (float) p[1];
-            buffer[3*i+2] = (float) p[2];
+    uploadForces();
+}
+
+void OpenCLCalcPlumedForceKernel::uploadForces() {
+    int numParticles = contextImpl.getSystem().getNumParticles();
+    double* counters = storage->getCounters();
+    PlumedTraceSpan uploadSpan("upload forces");
+    auto transferStart = chrono::steady_clock::now();
+    PlumedHardwareCounterScope transferEvents(useHardwareCounters ? counters+PlumedValueStorage::TransferCycles : NULL);
+    if (cl.getUseDoublePrecision())
+        packPlumedForces(forces, (double*) pinnedMemory, 0, numParticles);
+    else
+        packPlumedForces(forces, (float*) pinnedMemory, 0, numParticles);
+    plumedForces->upload(pinnedMemory, false);
+    if (contacts) {
+        // Add the forces of the contact variables.  The queue runs this after the upload.
+
+        if (useDoubleContactValues)
+            contactVariableForces.upload(contactForces.data());
+        else {
+            vector<float> floatForces(contactForces.begin(), contactForces.end());
+            contactVariableForces.upload(floatForces.data());
         }
+        cl.executeKernel(addContactForcesKernel, contactAtoms.getSize());
     }
-    plumedForces->upload(cl.getPinnedBuffer(), false);
+    counters[PlumedValueStorage::TransferTime] += chrono::duration<double>(chrono::steady_clock::now()-transferStart).count();
 }
 
 double OpenCLCalcPlumedForceKernel::addForces(bool includeForces, bool includeEnergy, int groups) {
@@ -237,10 +590,13 @@ double OpenCLCalcPlumedForceKernel::addForces(bool includeForces, bool includeEn
 
     // Wait until executeOnWorkerThread() is finished.
     
+    PlumedTraceSpan waitSpan("wait for worker thread");
     cl.getWorkThread().flush();
+    waitSpan.end();
 
     // Add in the forces.
     
+    PlumedTraceSpan span("addForces");
     if (includeForces) {
         addForcesKernel.setArg<cl::Buffer>(0, plumedForces->getDeviceBuffer());
         addForcesKernel.setArg<cl::Buffer>(1, cl.getForceBuffers().getDeviceBuffer());
@@ -250,7 +606,19 @@ double OpenCLCalcPlumedForceKernel::addForces(bool includeForces, bool includeEn
     
     // Return the energy.
     
-    double energy = 0;
-    plumed_cmd(plumedmain, "getBias", &energy);
-    return energy;
+    if (!metadynamics)
+        plumedmain.cmd("getBias", &storage->getBias());
+    return storage->getBias();
+}
+
+void OpenCLCalcPlumedForceKernel::getCollectiveVariableValues(vector<double>& values) const {
+    values.assign(storage->getValues(), storage->getValues()+storage->getNumValues());
+}
+
+double OpenCLCalcPlumedForceKernel::getBiasEnergy() const {
+    return storage->getBias();
+}
+
+shared_ptr<PlumedValueStorage> OpenCLCalcPlumedForceKernel::getValueStorage() const {
+    return storage;
 }
@@ -36,7 +36,14 @@
 #include "openmm/internal/ContextImpl.h"
 #include "openmm/opencl/OpenCLContext.h"
 #include "openmm/opencl/OpenCLArray.h"
-#include "wrapper/Plumed.h"
+#include "internal/PlumedContactVariables.h"
+#include "internal/PlumedCoordinateExport.h"
+#include "internal/PlumedKernelHandle.h"
+#include "internal/PlumedLoadBalanceMonitor.h"
+#include "internal/PlumedMetadynamics.h"
+#include "internal/PlumedReuseCheck.h"
+#include "internal/PlumedStepSchedule.h"
+#include <memory>
 #include <vector>
 
 namespace PlumedPlugin {
@@ -47,7 +54,7 @@ namespace PlumedPlugin {
 class OpenCLCalcPlumedForceKernel : public CalcPlumedForceKernel {
 public:
     OpenCLCalcPlumedForceKernel(std::string name, const OpenMM::Platform& platform, OpenMM::ContextImpl& contextImpl, OpenMM::OpenCLContext& cl) :
-            CalcPlumedForceKernel(name, platform), contextImpl(contextImpl), cl(cl), hasInitialized(false), plumedForces(NULL), lastStepIndex(0) {
+            CalcPlumedForceKernel(name, platform), contextImpl(contextImpl), cl(cl), hasInitialized(false), plumedForces(NULL), pinnedBuffer(NULL), lastStepIndex(0), storage(new PlumedValueStorage(0)), useHardwareCounters(false), countCalculationEvents(false), deterministic(false), positions(NULL) {
     }
     ~OpenCLCalcPlumedForceKernel();
     /**
@@ -66,6 +73,26 @@ public:
      * @return the potential energy due to the force
      */
     double execute(OpenMM::ContextImpl& context, bool includeForces, bool includeEnergy);
+    /**
+     * Record that the integrator is starting a time step.
+     *
+     * @param context        the context in which to execute this kernel
+     */
+    void beginStep(OpenMM::ContextImpl& context);
+    /**
+     * Get the values of the PLUMED values recorded during the most recent calculation.
+     *
+     * @param values     the values are stored into this
+     */
+    void getCollectiveVariableValues(std::vector<double>& values) const;
+    /**
+     * Get the bias energy computed by PLUMED during the most recent calculation.
+     */
+    double getBiasEnergy() const;
+    /**
+     * Get the storage into which the kernel records the bias, timing counters and PLUMED values.
+     */
+    std::shared_ptr<PlumedValueStorage> getValueStorage() const;
     /**
      * The is called by the pre-computation to start the calculation running.
      */
@@ -74,23 +101,89 @@ public:
      * This is called by the worker thread to do the computation.
      */
     void executeOnWorkerThread();
+    /**
+     * Upload the forces computed on the worker thread to the device.  This is called on the worker thread.
+     */
+    void uploadForces();
     /**
      * This is called by the post-computation to add the forces to the main array.
      */
     double addForces(bool includeForces, bool includeEnergy, int groups);
 private:
+    /**
+     * Create the device arrays and kernels for the COORDINATION and CONTACTMAP variables computed on the device.
+     */
+    void initializeContacts();
+    /**
+     * Compute the contact variables on the device and download their values to contactValues.
+     */
+    void computeContacts();
+    /**
+     * Transfer the positions of atoms from the device for the coordinate export.
+     *
+     * @param atoms      the atoms to transfer
+     * @param allAtoms   if true, all particles are transferred and atoms is ignored
+     * @param result     the positions are stored into this, at the indices of the atoms
+     */
+    void transferPositions(const std::vector<int>& atoms, bool allAtoms, std::vector<OpenMM::Vec3>& result);
+    /**
+     * Get the positions of neededAtoms from the coordinate export.
+     */
+    void getNeededPositions();
     class ExecuteTask;
     class StartCalculationPreComputation;
     class AddForcesPostComputation;
-    plumed plumedmain;
+    // The log is declared before plumedmain, so it stays open until PLUMED has been finalized.
+    std::shared_ptr<FILE> logStream;
+    PlumedKernelHandle plumedmain;
     bool hasInitialized, usesPeriodic;
     OpenMM::ContextImpl& contextImpl;
     OpenMM::OpenCLContext& cl;
     OpenMM::OpenCLArray* plumedForces;
+    // The forces are uploaded from host memory of their own rather than the context's pinned buffer, which the
+    // main thread may use while the worker thread fills this one.
+    cl::Buffer* pinnedBuffer;
+    void* pinnedMemory;
     cl::Kernel addForcesKernel;
     int lastStepIndex, forceGroupFlag;
-    std::vector<double> masses, charges;
-    std::vector<OpenMM::Vec3> positions, forces;
+    // The step and whether to update are decided by beginComputation() for the worker thread.
+    int step;
+    bool update;
+    std::unique_ptr<PlumedStepSchedule> schedule;
+    // When results may be reused, plumedForces on the device keeps the forces of the last computation by PLUMED.
+    std::unique_ptr<PlumedReuseCheck> reuse;
+    std::shared_ptr<const std::vector<double> > masses;
+    std::vector<double> charges;
+    std::shared_ptr<PlumedValueStorage> storage;
+    std::unique_ptr<PlumedLoadBalanceMonitor> loadBalance;
+    std::unique_ptr<PlumedMetadynamics> metadynamics;
+    std::unique_ptr<PlumedContactVariables> contacts;
+    std::vector<double> contactValues, contactForces;
+    // The pairs are listed in the order of PlumedContactVariables, and contactAtoms lists the pairs of each atom.
+    OpenMM::OpenCLArray contactPositions, contactPairAtoms, contactPairParameters, contactPairValues, contactPairDerivatives;
+    OpenMM::OpenCLArray contactVariableStart, contactPairVariable, contactAtoms, contactAtomStart, contactAtomEntries;
+    OpenMM::OpenCLArray contactVariableValues, contactVariableForces;
+    cl::Kernel gatherContactPositionsKernel, computeContactPairsKernel, sumContactVariablesKernel, addContactForcesKernel;
+    bool useDoubleContactValues;
+    bool useHardwareCounters;
+    // The counters only see the calling thread, so PLUMED's computation is only counted when it runs on one thread.
+    bool countCalculationEvents;
+    // A deterministic force runs PLUMED on one thread while it computes.
+    bool deterministic;
+    // The positions are shared with the other PlumedForces in the Context through the export, and only those of
+    // neededAtoms are valid.
+    std::shared_ptr<PlumedCoordinateExport> coordinateExport;
+    int exportClient;
+    std::vector<int> neededAtoms;
+    const OpenMM::Vec3* positions;
+    // The positions of the atoms used by the previous computation, to tell whether the integrator moved the particles.
+    std::vector<int> checkedAtoms;
+    std::vector<OpenMM::Vec3> checkedPositions;
+    OpenMM::OpenCLArray exportSortedIndex, exportAtoms, exportPositions, exportAtomSortedIndex;
+    cl::Kernel invertAtomIndexKernel, gatherPositionsKernel;
+    std::vector<double> downloadedPositions;
+    std::vector<int> downloadedSortedIndex;
+    std::vector<OpenMM::Vec3> forces;
 };
 
 } // namespace PlumedPlugin
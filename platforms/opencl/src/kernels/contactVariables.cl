@@ -0,0 +1,130 @@
+/**
+ * Copy the positions of the atoms to an array in their original order.
+ */
+__kernel void gatherContactPositions(__global const real4* restrict posq, __global const int* restrict atomIndex, __global real4* restrict positions) {
+    for (int atom = get_global_id(0); atom < NUM_ATOMS; atom += get_global_size(0))
+        positions[atomIndex[atom]] = posq[atom];
+}
+
+/**
+ * Compute the switching function of every pair, and its derivative with respect to the position of the second atom.
+ * This matches PlumedContactVariables::computeValues().
+ */
+__kernel void computeContactPairs(__global const real4* restrict positions, __global const int2* restrict pairAtoms,
+        __global const real* restrict pairParameters, __global real* restrict pairValues, __global real4* restrict pairDerivatives,
+        real4 boxVecX, real4 boxVecY, real4 boxVecZ, int triclinic) {
+    for (int pair = get_global_id(0); pair < NUM_PAIRS; pair += get_global_size(0)) {
+        __global const real* p = &pairParameters[pair*NUM_PARAMETERS];
+        int2 atoms = pairAtoms[pair];
+        real4 pos1 = positions[atoms.x];
+        real4 pos2 = positions[atoms.y];
+        real dx = pos2.x-pos1.x, dy = pos2.y-pos1.y, dz = pos2.z-pos1.z;
+        if (p[PARAMETER_PERIODIC] != 0) {
+            real scale = floor(dz/boxVecZ.z+(real) 0.5);
+            dx -= scale*boxVecZ.x;
+            dy -= scale*boxVecZ.y;
+            dz -= scale*boxVecZ.z;
+            scale = floor(dy/boxVecY.y+(real) 0.5);
+            dx -= scale*boxVecY.x;
+            dy -= scale*boxVecY.y;
+            scale = floor(dx/boxVecX.x+(real) 0.5);
+            dx -= scale*boxVecX.x;
+            if (triclinic) {
+                real bestX = dx, bestY = dy, bestZ = dz, bestR2 = dx*dx+dy*dy+dz*dz;
+                for (int i = -1; i <= 1; i++)
+                    for (int j = -1; j <= 1; j++)
+                        for (int k = -1; k <= 1; k++) {
+                            real x = dx+i*boxVecX.x+j*boxVecY.x+k*boxVecZ.x;
+                            real y = dy+j*boxVecY.y+k*boxVecZ.y;
+                            real z = dz+k*boxVecZ.z;
+                            real r2 = x*x+y*y+z*z;
+                            if (r2 < bestR2) {
+                                bestR2 = r2;
+                                bestX = x;
+                                bestY = y;
+                                bestZ = z;
+                            }
+                        }
+                dx = bestX;
+                dy = bestY;
+                dz = bestZ;
+            }
+        }
+        real r = sqrt(dx*dx+dy*dy+dz*dz);
+        real value = 0, dfunc = 0;
+        if (r <= p[PARAMETER_DMAX]) {
+            real x = (r-p[PARAMETER_D0])*p[PARAMETER_INVR0];
+            value = 1;
+            if (x > 0) {
+                real nn = p[PARAMETER_NN], mm = p[PARAMETER_MM];
+                if (fabs(x-1) < SWITCH_EPSILON) {
+                    value = nn/mm;
+                    dfunc = (real) 0.5*nn*(nn-mm)/mm;
+                }
+                else {
+                    real xn = pow(x, nn-1), xm = pow(x, mm-1);
+                    real numerator = 1-xn*x, denominator = 1-xm*x;
+                    value = numerator/denominator;
+                    dfunc = (-nn*xn*denominator+mm*xm*numerator)/(denominator*denominator);
+                }
+                dfunc *= p[PARAMETER_INVR0];
+            }
+            value = value*p[PARAMETER_STRETCH]+p[PARAMETER_SHIFT];
+            dfunc *= p[PARAMETER_STRETCH];
+            if (r > 0)
+                dfunc /= r;
+        }
+        pairValues[pair] = value*p[PARAMETER_WEIGHT];
+        dfunc *= p[PARAMETER_WEIGHT];
+        pairDerivatives[pair] = (real4) (dfunc*dx, dfunc*dy, dfunc*dz, 0);
+    }
+}
+
+/**
+ * Sum the values of the pairs of each variable.  Each work group handles one variable at a time.
+ */
+__kernel void sumContactVariables(__global const real* restrict pairValues, __global const int* restrict variableStart, __global mixed* restrict values) {
+    __local mixed sum[CONTACT_BLOCK_SIZE];
+    for (int variable = get_group_id(0); variable < NUM_CONTACT_VARIABLES; variable += get_num_groups(0)) {
+        mixed partial = 0;
+        for (int pair = variableStart[variable]+get_local_id(0); pair < variableStart[variable+1]; pair += get_local_size(0))
+            partial += pairValues[pair];
+        sum[get_local_id(0)] = partial;
+        barrier(CLK_LOCAL_MEM_FENCE);
+        for (int offset = get_local_size(0)/2; offset > 0; offset /= 2) {
+            if (get_local_id(0) < offset)
+                sum[get_local_id(0)] += sum[get_local_id(0)+offset];
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+        if (get_local_id(0) == 0)
+            values[variable] = sum[0];
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+}
+
+/**
+ * Apply the forces PLUMED computed on the variables to the atoms, adding them to the forces uploaded from PLUMED.
+ * Each work item sums all the pairs of one atom, so no atomic operations are needed.
+ */
+__kernel void addContactForces(__global const real4* restrict pairDerivatives, __global const int* restrict pairVariable,
+        __global const int* restrict contactAtoms, __global const int* restrict atomStart, __global const int* restrict atomEntries,
+        __global const mixed* restrict variableForces, __global real* restrict forces) {
+    for (int i = get_global_id(0); i < NUM_CONTACT_ATOMS; i += get_global_size(0)) {
+        real fx = 0, fy = 0, fz = 0;
+        for (int j = atomStart[i]; j < atomStart[i+1]; j++) {
+            int entry = atomEntries[j];
+            int pair = entry/2;
+            real scale = (real) variableForces[pairVariable[pair]];
+            if ((entry&1) == 0)
+                scale = -scale;
+            real4 derivative = pairDerivatives[pair];
+            fx += scale*derivative.x;
+            fy += scale*derivative.y;
+            fz += scale*derivative.z;
+        }
+        int atom = contactAtoms[i];
+        forces[3*atom] += fx;
+        forces[3*atom+1] += fy;
+        forces[3*atom+2] += fz;
+    }
+}
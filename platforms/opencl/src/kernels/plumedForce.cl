@@ -7,3 +7,30 @@ __kernel void addForces(__global const real* restrict forces, __global real4* re
     }
 }
 
+
+/**
+ * Record the index in the sorted arrays of every atom.
+ */
+__kernel void invertAtomIndex(__global const int* restrict atomIndex, __global int* restrict sortedIndex) {
+    for (int atom = get_global_id(0); atom < NUM_ATOMS; atom += get_global_size(0))
+        sortedIndex[atomIndex[atom]] = atom;
+}
+
+/**
+ * Copy the positions of a list of atoms, given by their indices in the System, to a compact array.  The sorted
+ * index of each one is recorded so the host can apply its periodic cell offset.
+ */
+__kernel void gatherPositions(__global const real4* restrict posq, __global const real4* restrict posqCorrection, __global const int* restrict sortedIndex,
+        __global const int* restrict atoms, int numAtoms, __global mixed4* restrict positions, __global int* restrict atomSortedIndex) {
+    for (int i = get_global_id(0); i < numAtoms; i += get_global_size(0)) {
+        int index = sortedIndex[atoms[i]];
+        real4 pos = posq[index];
+#ifdef USE_MIXED_PRECISION
+        real4 correction = posqCorrection[index];
+        positions[i] = (mixed4) (pos.x+(mixed) correction.x, pos.y+(mixed) correction.y, pos.z+(mixed) correction.z, 0);
+#else
+        positions[i] = (mixed4) (pos.x, pos.y, pos.z, 0);
+#endif
+        atomSortedIndex[i] = index;
+    }
+}
@@ -36,15 +36,23 @@
 #include "PlumedForce.h"
 #include "openmm/internal/AssertionUtilities.h"
 #include "openmm/Context.h"
+#include "openmm/CustomBondForce.h"
 #include "openmm/CustomExternalForce.h"
+#include "openmm/CustomIntegrator.h"
+#include "openmm/HarmonicBondForce.h"
 #include "openmm/LangevinIntegrator.h"
 #include "openmm/NonbondedForce.h"
 #include "openmm/Platform.h"
 #include "openmm/System.h"
+#include "openmm/VerletIntegrator.h"
 #include "openmm/reference/SimTKOpenMMRealType.h"
+#include "sfmt/SFMT.h"
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <mpi.h>
 
@@ -67,8 +75,9 @@ void testForce() {
     string script =
         "d: DISTANCE ATOMS=1,3\n"
         "BIASVALUE ARG=d";
-    MPI_Comm comm;
-    PlumedForce* plumed = new PlumedForce(script, comm);
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
+    PlumedForce* plumed = new PlumedForce(script, comm, comm2);
     system.addForce(plumed);
     LangevinIntegrator integ(300.0, 1.0, 1.0);
     Platform& platform = Platform::getPlatformByName("OpenCL");
@@ -99,8 +108,9 @@ void testMetadynamics() {
     string script =
         "p: POSITION ATOM=1\n"
         "METAD ARG=p.x SIGMA=0.5 HEIGHT=0.1 PACE=1";
-    MPI_Comm comm;
-    PlumedForce* plumed = new PlumedForce(script, comm);
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
+    PlumedForce* plumed = new PlumedForce(script, comm, comm2);
     system.addForce(plumed);
     vector<Vec3> positions;
     positions.push_back(Vec3());
@@ -148,8 +158,9 @@ void testWellTemperedMetadynamics() {
     system.addForce(external);
 
     // Create a well-tempered metadynamics simulation
-    MPI_Comm comm;
-    PlumedForce* plumed = new PlumedForce(script, comm);
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
+    PlumedForce* plumed = new PlumedForce(script, comm, comm2);
     plumed->setTemperature(temperatue); // This is tested here!
     system.addForce(plumed);
     LangevinIntegrator integ(temperatue, 1.0, 1.0);
@@ -188,8 +199,9 @@ void testMassesCharges() {
 
     // Setup PLUMED to write the mass and chage of the particles to a file
     const string script = "DUMPMASSCHARGE ATOMS=@mdatoms FILE=mass_charge.txt";
-    MPI_Comm comm;
-    PlumedForce* plumed = new PlumedForce(script, comm);
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
+    PlumedForce* plumed = new PlumedForce(script, comm, comm2);
     system.addForce(plumed);
 
     // Setup simulation
@@ -262,8 +274,9 @@ void testScript() {
                           "  # A comment in the middle\n"
                           "  STRIDE=10\n"
                           "...";
-    MPI_Comm comm;
-    PlumedForce* plumed = new PlumedForce(script, comm);
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
+    PlumedForce* plumed = new PlumedForce(script, comm, comm2);
     system.addForce(plumed);
 
     // Setup simulation
@@ -274,6 +287,556 @@ void testScript() {
     // If the parser fails, an exception is thrown during the context creation
 }
 
+void testCollectiveVariables() {
+    // Create a System that applies a force based on the distance between two atoms and record the distance.
+
+    const int numParticles = 4;
+    System system;
+    vector<Vec3> positions(numParticles);
+    for (int i = 0; i < numParticles; i++) {
+        system.addParticle(1.0);
+        positions[i] = Vec3(i, 0.1*i, -0.3*i);
+    }
+    string script =
+        "d: DISTANCE ATOMS=1,3\n"
+        "p: POSITION ATOM=2\n"
+        "BIASVALUE ARG=d";
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
+    PlumedForce* plumed = new PlumedForce(script, comm, comm2);
+    plumed->setCollectiveVariables({"d", "p.y"});
+    system.addForce(plumed);
+    LangevinIntegrator integ(300.0, 1.0, 1.0);
+    Platform& platform = Platform::getPlatformByName("OpenCL");
+    Context context(system, integ, platform);
+    context.setPositions(positions);
+
+    // PLUMED records the values when it is updated for a new step, so take one step and check the recorded values
+    // against the positions at which the force is then computed.
+
+    integ.step(1);
+    State state = context.getState(State::Positions | State::Energy);
+    positions = state.getPositions();
+    Vec3 delta = positions[0]-positions[2];
+    double dist = sqrt(delta.dot(delta));
+    vector<double> values;
+    plumed->getCollectiveVariableValues(context, values);
+    ASSERT_EQUAL(2, values.size());
+    ASSERT_EQUAL_TOL(dist, values[0], 1e-5);
+    ASSERT_EQUAL_TOL(positions[1][1], values[1], 1e-5);
+    ASSERT_EQUAL_TOL(dist, plumed->getBiasEnergy(context), 1e-5);
+
+    // The shared storage holds the same values and counts the calculations.
+
+    shared_ptr<PlumedValueStorage> storage = plumed->getValueStorage(context);
+    ASSERT_EQUAL(2, storage->getNumValues());
+    ASSERT_EQUAL(values[0], storage->getValues()[0]);
+    ASSERT_EQUAL(values[1], storage->getValues()[1]);
+    ASSERT_EQUAL(plumed->getBiasEnergy(context), storage->getBias());
+    double calculations = storage->getCounters()[PlumedValueStorage::NumCalculations];
+    ASSERT(calculations >= 2);
+    context.getState(State::Energy);
+    ASSERT_EQUAL(calculations+1, storage->getCounters()[PlumedValueStorage::NumCalculations]);
+}
+
+static PlumedForce* createStressSystem(int index, System& system, vector<Vec3>& positions) {
+    // Every System restrains a different distance to a different value, so results cannot be mixed up unnoticed.
+
+    for (int i = 0; i < 4; i++) {
+        system.addParticle(1.0+0.1*index);
+        positions.push_back(Vec3(i, 0.1*i*(index+1), -0.3*i));
+    }
+    stringstream script;
+    script << "d: DISTANCE ATOMS=1,3\n" << "RESTRAINT ARG=d AT=" << 0.5+0.1*index << " KAPPA=" << 10+index;
+    PlumedForce* plumed = new PlumedForce(script.str(), MPI_COMM_SELF, MPI_COMM_SELF);
+    plumed->setCollectiveVariables({"d"});
+    system.addForce(plumed);
+    return plumed;
+}
+
+void testConcurrentContexts() {
+    // Step many Contexts in one process from several threads at once, and check that each one ends up the same as the
+    // same Context stepped on its own.
+
+    const int numContexts = 16, numThreads = 4, numSteps = 50;
+    vector<vector<Vec3> > sequential(numContexts), concurrent(numContexts);
+    vector<double> sequentialValues(numContexts), concurrentValues(numContexts);
+    for (int i = 0; i < numContexts; i++) {
+        System system;
+        vector<Vec3> positions;
+        PlumedForce* plumed = createStressSystem(i, system, positions);
+        VerletIntegrator integ(0.002);
+        Context context(system, integ, Platform::getPlatformByName("OpenCL"));
+        context.setPositions(positions);
+        integ.step(numSteps);
+        sequential[i] = context.getState(State::Positions).getPositions();
+        vector<double> values;
+        plumed->getCollectiveVariableValues(context, values);
+        sequentialValues[i] = values[0];
+    }
+
+    // Each thread creates its Contexts, steps them in turn one step at a time, and destroys them, so creation,
+    // stepping and destruction all overlap between threads.
+
+    vector<exception_ptr> errors(numThreads);
+    vector<thread> threads;
+    for (int t = 0; t < numThreads; t++)
+        threads.push_back(thread([&, t] () {
+            try {
+                vector<unique_ptr<System> > systems;
+                vector<unique_ptr<VerletIntegrator> > integrators;
+                vector<unique_ptr<Context> > contexts;
+                vector<PlumedForce*> forces;
+                for (int i = t; i < numContexts; i += numThreads) {
+                    vector<Vec3> positions;
+                    systems.push_back(unique_ptr<System>(new System()));
+                    forces.push_back(createStressSystem(i, *systems.back(), positions));
+                    integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.002)));
+                    contexts.push_back(unique_ptr<Context>(new Context(*systems.back(), *integrators.back(), Platform::getPlatformByName("OpenCL"))));
+                    contexts.back()->setPositions(positions);
+                }
+                for (int step = 0; step < numSteps; step++)
+                    for (auto& integ : integrators)
+                        integ->step(1);
+                for (int k = 0; k < contexts.size(); k++) {
+                    int i = t+k*numThreads;
+                    concurrent[i] = contexts[k]->getState(State::Positions).getPositions();
+                    vector<double> values;
+                    forces[k]->getCollectiveVariableValues(*contexts[k], values);
+                    concurrentValues[i] = values[0];
+                }
+            }
+            catch (...) {
+                errors[t] = current_exception();
+            }
+        }));
+    for (auto& t : threads)
+        t.join();
+    for (auto& error : errors)
+        if (error)
+            rethrow_exception(error);
+    for (int i = 0; i < numContexts; i++) {
+        ASSERT_EQUAL_TOL(sequentialValues[i], concurrentValues[i], 1e-5);
+        for (int j = 0; j < sequential[i].size(); j++)
+            ASSERT_EQUAL_VEC(sequential[i][j], concurrent[i][j], 1e-5);
+    }
+}
+
+void testNativeMetadynamics() {
+    // Compute well-tempered metadynamics on a grid with PLUMED and with the plugin's own metadynamics along the same
+    // path, and check that the energies and forces agree.
+
+    string script = "d: DISTANCE ATOMS=1,3\n"
+                    "p: POSITION ATOM=2 NOPBC\n"
+                    "m: METAD ARG=d,p.y SIGMA=0.05,0.04 HEIGHT=0.5 PACE=1 BIASFACTOR=5 TEMP=300 "
+                    "GRID_MIN=-1,-1 GRID_MAX=2,2 GRID_BIN=300,300 FILE=HILLS.native";
+    vector<unique_ptr<System> > systems;
+    vector<unique_ptr<LangevinIntegrator> > integrators;
+    vector<unique_ptr<Context> > contexts;
+    for (int i = 0; i < 2; i++) {
+        systems.push_back(unique_ptr<System>(new System()));
+        for (int j = 0; j < 3; j++)
+            systems[i]->addParticle(1.0);
+        PlumedForce* plumed = new PlumedForce(script, MPI_COMM_SELF, MPI_COMM_SELF);
+        plumed->setUseNativeMetadynamics(i == 1);
+        systems[i]->addForce(plumed);
+        integrators.push_back(unique_ptr<LangevinIntegrator>(new LangevinIntegrator(300.0, 1.0, 0.002)));
+        contexts.push_back(unique_ptr<Context>(new Context(*systems[i], *integrators[i], Platform::getPlatformByName("OpenCL"))));
+    }
+    vector<Vec3> positions = {Vec3(0, 0, 0), Vec3(0.1, 0.3, 0), Vec3(0.5, 0, 0)};
+    for (int step = 0; step < 40; step++) {
+        for (int j = 0; j < 3; j++)
+            positions[j] += Vec3(sin(step+j), cos(1.3*step+j), sin(0.7*step-j))*0.02;
+        vector<State> states;
+        for (int i = 0; i < 2; i++) {
+            contexts[i]->setStepCount(step);
+            contexts[i]->setPositions(positions);
+            states.push_back(contexts[i]->getState(State::Energy | State::Forces));
+        }
+        ASSERT_EQUAL_TOL(states[0].getPotentialEnergy(), states[1].getPotentialEnergy(), 1e-5);
+        for (int j = 0; j < 3; j++)
+            ASSERT_EQUAL_VEC(states[0].getForces()[j], states[1].getForces()[j], 1e-4);
+    }
+}
+
+void testDeviceContactVariables() {
+    // Compute COORDINATION and CONTACTMAP in a triclinic box with PLUMED and on the device, and check that the
+    // energies, forces and recorded values agree.
+
+    string script = "c: COORDINATION GROUPA=1-8 SWITCH={RATIONAL R_0=0.4 D_MAX=1.0}\n"
+                    "cm: CONTACTMAP ATOMS1=1,2 ATOMS2=3,10 WEIGHT1=1.0 WEIGHT2=0.5 SWITCH={RATIONAL R_0=0.3 NN=8 MM=12} SUM\n"
+                    "d: DISTANCE ATOMS=1,3\n"
+                    "RESTRAINT ARG=c,cm,d AT=1.0,0.5,0.4 KAPPA=10,20,5";
+    const int numParticles = 10;
+    vector<unique_ptr<System> > systems;
+    vector<unique_ptr<VerletIntegrator> > integrators;
+    vector<unique_ptr<Context> > contexts;
+    vector<PlumedForce*> forces;
+    for (int i = 0; i < 2; i++) {
+        systems.push_back(unique_ptr<System>(new System()));
+        for (int j = 0; j < numParticles; j++)
+            systems[i]->addParticle(1.0);
+        systems[i]->setDefaultPeriodicBoxVectors(Vec3(1.2, 0, 0), Vec3(0.3, 1.1, 0), Vec3(-0.2, 0.4, 1.3));
+        NonbondedForce* nonbonded = new NonbondedForce();
+        for (int j = 0; j < numParticles; j++)
+            nonbonded->addParticle(0.0, 0.1, 0.0);
+        nonbonded->setNonbondedMethod(NonbondedForce::CutoffPeriodic);
+        nonbonded->setCutoffDistance(0.5);
+        systems[i]->addForce(nonbonded);
+        PlumedForce* plumed = new PlumedForce(script, MPI_COMM_SELF, MPI_COMM_SELF);
+        plumed->setCollectiveVariables({"c", "cm"});
+        plumed->setUseDeviceContactVariables(i == 1);
+        systems[i]->addForce(plumed);
+        forces.push_back(plumed);
+        integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.002)));
+        contexts.push_back(unique_ptr<Context>(new Context(*systems[i], *integrators[i], Platform::getPlatformByName("OpenCL"))));
+    }
+    for (int step = 0; step < 10; step++) {
+        vector<Vec3> positions(numParticles);
+        for (int j = 0; j < numParticles; j++)
+            positions[j] = Vec3(0.75+0.7*sin(1.1*step+j), 0.75+0.7*cos(0.9*step+2*j), 0.75+0.7*sin(0.3*step-3*j));
+        vector<State> states;
+        vector<vector<double> > values(2);
+        for (int i = 0; i < 2; i++) {
+            contexts[i]->setStepCount(step);
+            contexts[i]->setPositions(positions);
+            states.push_back(contexts[i]->getState(State::Energy | State::Forces));
+            forces[i]->getCollectiveVariableValues(*contexts[i], values[i]);
+        }
+        ASSERT_EQUAL_TOL(states[0].getPotentialEnergy(), states[1].getPotentialEnergy(), 1e-4);
+        for (int j = 0; j < numParticles; j++)
+            ASSERT_EQUAL_VEC(states[0].getForces()[j], states[1].getForces()[j], 1e-3);
+        if (step > 0)
+            for (int j = 0; j < 2; j++)
+                ASSERT_EQUAL_TOL(values[0][j], values[1][j], 1e-4);
+    }
+}
+
+void testSharedCoordinateExport() {
+    // Put two PlumedForces in different force groups of one Context, so they share the positions transferred from the
+    // device, and compare them to Contexts that each contain one of them.  The atoms leave the periodic box, and the
+    // neighbor list makes the atoms PLUMED needs change from step to step.
+
+    const int numParticles = 50;
+    vector<string> scripts = {"d: DISTANCE ATOMS=1,20\n"
+                              "RESTRAINT ARG=d AT=1.0 KAPPA=10",
+                              "c: COORDINATION GROUPA=3-10 GROUPB=30-40 R_0=0.5 NLIST NL_CUTOFF=1.2 NL_STRIDE=5\n"
+                              "p: POSITION ATOM=45\n"
+                              "RESTRAINT ARG=c,p.x AT=2,1 KAPPA=1,5"};
+    vector<unique_ptr<System> > systems;
+    vector<unique_ptr<VerletIntegrator> > integrators;
+    vector<unique_ptr<Context> > contexts;
+    for (int i = 0; i < 3; i++) {
+        systems.push_back(unique_ptr<System>(new System()));
+        systems[i]->setDefaultPeriodicBoxVectors(Vec3(3, 0, 0), Vec3(0, 3, 0), Vec3(0, 0, 3));
+        NonbondedForce* nonbonded = new NonbondedForce();
+        for (int j = 0; j < numParticles; j++) {
+            systems[i]->addParticle(1.0);
+            nonbonded->addParticle(0.0, 0.2, 0.1);
+        }
+        nonbonded->setNonbondedMethod(NonbondedForce::CutoffPeriodic);
+        nonbonded->setCutoffDistance(1.0);
+        nonbonded->setForceGroup(2);
+        systems[i]->addForce(nonbonded);
+        for (int j = 0; j < 2; j++)
+            if (i == 0 || i == j+1) {
+                PlumedForce* plumed = new PlumedForce(scripts[j], MPI_COMM_SELF, MPI_COMM_SELF);
+                plumed->setForceGroup(j);
+                systems[i]->addForce(plumed);
+            }
+        integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.002)));
+        contexts.push_back(unique_ptr<Context>(new Context(*systems[i], *integrators[i], Platform::getPlatformByName("OpenCL"))));
+    }
+    vector<Vec3> positions(numParticles);
+    for (int j = 0; j < numParticles; j++)
+        positions[j] = Vec3(3*sin(1.7*j)+1.5, 3*cos(2.3*j)+1.5, 3*sin(0.9*j+1.0)+1.5);
+    contexts[0]->setPositions(positions);
+    for (int iteration = 0; iteration < 5; iteration++) {
+        State state = contexts[0]->getState(State::Positions);
+        for (int i = 1; i < 3; i++) {
+            contexts[i]->setPositions(state.getPositions());
+            contexts[i]->setStepCount(contexts[0]->getStepCount());
+        }
+        for (int j = 0; j < 2; j++) {
+            State state1 = contexts[0]->getState(State::Energy | State::Forces, false, 1<<j);
+            State state2 = contexts[j+1]->getState(State::Energy | State::Forces, false, 1<<j);
+            ASSERT_EQUAL_TOL(state2.getPotentialEnergy(), state1.getPotentialEnergy(), 1e-5);
+            for (int k = 0; k < numParticles; k++)
+                ASSERT_EQUAL_VEC(state2.getForces()[k], state1.getForces()[k], 1e-4);
+        }
+        State all = contexts[0]->getState(State::Energy, false, 3);
+        double expected = contexts[1]->getState(State::Energy, false, 1).getPotentialEnergy()+contexts[2]->getState(State::Energy, false, 2).getPotentialEnergy();
+        ASSERT_EQUAL_TOL(expected, all.getPotentialEnergy(), 1e-5);
+        integrators[0]->step(107);
+    }
+}
+
+/**
+ * Create a CustomIntegrator with the same program as OpenMM's MTSIntegrator, which evaluates force group 1 once per
+ * step and force group 0 in a number of substeps.
+ */
+CustomIntegrator* createMTSIntegrator(double dt, int substeps) {
+    CustomIntegrator* integrator = new CustomIntegrator(dt);
+    integrator->addPerDofVariable("x1", 0);
+    integrator->addUpdateContextState();
+    integrator->addComputePerDof("v", "v+0.5*dt*f1/m");
+    for (int i = 0; i < substeps; i++) {
+        string step = "(dt/"+to_string(substeps)+")";
+        integrator->addComputePerDof("v", "v+0.5*"+step+"*f0/m");
+        integrator->addComputePerDof("x1", "x");
+        integrator->addComputePerDof("x", "x+"+step+"*v");
+        integrator->addConstrainPositions();
+        integrator->addComputePerDof("v", "(x-x1)/"+step);
+        integrator->addComputePerDof("v", "v+0.5*"+step+"*f0/m");
+    }
+    integrator->addComputePerDof("v", "v+0.5*dt*f1/m");
+    return integrator;
+}
+
+/**
+ * Create a System whose fast force group 0 holds bonds and whose slow force group 1 holds the given force.
+ */
+void createMTSSystem(System& system, vector<Vec3>& positions, Force* slowForce) {
+    const int numParticles = 4;
+    HarmonicBondForce* bonds = new HarmonicBondForce();
+    for (int i = 0; i < numParticles; i++) {
+        system.addParticle(1.0+i);
+        positions.push_back(Vec3(0.3*i, 0.1*(i%2), -0.05*i));
+        if (i > 0)
+            bonds->addBond(i-1, i, 0.3, 5000.0);
+    }
+    system.addForce(bonds);
+    slowForce->setForceGroup(1);
+    system.addForce(slowForce);
+}
+
+void testMultipleTimeStep() {
+    // PLUMED is in the slow force group, which the integrator computes once per step, after moving the particles.
+
+    const int numSteps = 40;
+    const double dt = 0.002;
+    System system;
+    vector<Vec3> positions;
+    PlumedForce* plumed = new PlumedForce("d: DISTANCE ATOMS=1,3\n"
+                                          "METAD ARG=d SIGMA=0.05 HEIGHT=0.1 PACE=2 FILE=HILLS.mts", MPI_COMM_SELF, MPI_COMM_SELF);
+    plumed->setCollectiveVariables({"d"});
+    createMTSSystem(system, positions, plumed);
+    unique_ptr<CustomIntegrator> integrator(createMTSIntegrator(dt, 4));
+    unique_ptr<Context> context(new Context(system, *integrator, Platform::getPlatformByName("OpenCL")));
+    context->setPositions(positions);
+    context->setVelocitiesToTemperature(300.0, 1);
+
+    // The update for each step must see the positions of that step, even when a computation of another force group
+    // forces the integrator to recompute PLUMED at the start of the next step.
+
+    vector<double> distances(numSteps+1);
+    shared_ptr<PlumedValueStorage> storage = plumed->getValueStorage(*context);
+    for (int i = 1; i <= numSteps; i++) {
+        integrator->step(1);
+        State state = context->getState(State::Positions);
+        Vec3 delta = state.getPositions()[0]-state.getPositions()[2];
+        distances[i] = sqrt(delta.dot(delta));
+        vector<double> values;
+        plumed->getCollectiveVariableValues(*context, values);
+        ASSERT_EQUAL_TOL(distances[i], values[0], 1e-5);
+        if (i%3 == 0)
+            context->getState(State::Energy, false, 1<<0);
+    }
+
+    // PLUMED was computed once per step, plus at the start of the first step and of every step after getState().
+    // Only the computations at the ends of steps update it, which adds one hill every other step.
+
+    ASSERT_EQUAL(numSteps+numSteps/3+1, storage->getCounters()[PlumedValueStorage::NumCalculations]);
+    context.reset();
+    ifstream hills("HILLS.0.mts");
+    string line;
+    int numHills = 0;
+    while (getline(hills, line)) {
+        if (line[0] == '#')
+            continue;
+        double time, d;
+        stringstream(line) >> time >> d;
+        int step = (int) round(time/dt);
+        ASSERT_EQUAL(0, step%2);
+        ASSERT_EQUAL_TOL(distances[step], d, 1e-5);
+        numHills++;
+    }
+    ASSERT_EQUAL(numSteps/2, numHills);
+
+    // The integrator applies the forces of the slow group with the outer step, so a trajectory with PLUMED must match
+    // one with the same force as a CustomBondForce.
+
+    vector<State> states;
+    for (int i = 0; i < 2; i++) {
+        System system;
+        vector<Vec3> positions;
+        Force* restraint;
+        if (i == 0)
+            restraint = new PlumedForce("d: DISTANCE ATOMS=1,3\n"
+                                        "RESTRAINT ARG=d AT=0.5 KAPPA=200", MPI_COMM_SELF, MPI_COMM_SELF);
+        else {
+            CustomBondForce* bond = new CustomBondForce("100*(r-0.5)^2");
+            bond->addBond(0, 2);
+            restraint = bond;
+        }
+        createMTSSystem(system, positions, restraint);
+        unique_ptr<CustomIntegrator> integrator(createMTSIntegrator(dt, 4));
+        Context context(system, *integrator, Platform::getPlatformByName("OpenCL"));
+        context.setPositions(positions);
+        integrator->step(50);
+        states.push_back(context.getState(State::Positions | State::Velocities));
+    }
+    for (int i = 0; i < system.getNumParticles(); i++) {
+        ASSERT_EQUAL_VEC(states[1].getPositions()[i], states[0].getPositions()[i], 1e-4);
+        ASSERT_EQUAL_VEC(states[1].getVelocities()[i], states[0].getVelocities()[i], 1e-3);
+    }
+}
+
+void testReuseTolerance() {
+    // Create two Contexts that restrain the distance between two atoms, one of which reuses the bias and forces while
+    // the atoms move less than the tolerance.
+
+    const int numParticles = 10;
+    const double tolerance = 0.01, kappa = 100.0, at = 0.5;
+    vector<unique_ptr<System> > systems;
+    vector<unique_ptr<VerletIntegrator> > integrators;
+    vector<unique_ptr<Context> > contexts;
+    vector<PlumedForce*> forces;
+    for (int i = 0; i < 2; i++) {
+        systems.push_back(unique_ptr<System>(new System()));
+        for (int j = 0; j < numParticles; j++)
+            systems[i]->addParticle(1.0);
+        PlumedForce* plumed = new PlumedForce("d: DISTANCE ATOMS=1,3\n"
+                                              "RESTRAINT ARG=d AT=0.5 KAPPA=100", MPI_COMM_SELF, MPI_COMM_SELF);
+        if (i == 1)
+            plumed->setReuseTolerance(tolerance);
+        systems[i]->addForce(plumed);
+        forces.push_back(plumed);
+        integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.002)));
+        contexts.push_back(unique_ptr<Context>(new Context(*systems[i], *integrators[i], Platform::getPlatformByName("OpenCL"))));
+    }
+    ASSERT_EQUAL(tolerance, forces[1]->getReuseTolerance());
+    OpenMM_SFMT::SFMT sfmt;
+    init_gen_rand(0, sfmt);
+    vector<Vec3> initialPositions(numParticles);
+    for (Vec3& p : initialPositions)
+        p = Vec3(genrand_real2(sfmt), genrand_real2(sfmt), genrand_real2(sfmt));
+
+    // Move the atoms by up to the tolerance.  The error of the reused results must stay within the bound given by
+    // the change of the restraint: the distance changes by at most 2*tolerance, and its direction by at most
+    // 4*tolerance/d.  The atoms PLUMED does not use may move anywhere.
+
+    // PLUMED asks for the positions of all atoms the first time, so the reference for the trials is the second
+    // computation.
+
+    shared_ptr<PlumedValueStorage> storage = forces[1]->getValueStorage(*contexts[1]);
+    const int numTrials = 20;
+    for (int trial = -1; trial <= numTrials; trial++) {
+        vector<Vec3> positions = initialPositions;
+        if (trial > 0)
+            for (int j = 0; j < numParticles; j++) {
+                Vec3 delta = Vec3(genrand_real2(sfmt)-0.5, genrand_real2(sfmt)-0.5, genrand_real2(sfmt)-0.5);
+                positions[j] += delta*(j == 0 || j == 2 ? 0.999*tolerance/sqrt(delta.dot(delta)) : 1.0);
+            }
+        vector<State> states;
+        for (int i = 0; i < 2; i++) {
+            contexts[i]->setPositions(positions);
+            states.push_back(contexts[i]->getState(State::Energy | State::Forces));
+        }
+        Vec3 delta = positions[0]-positions[2];
+        double d = sqrt(delta.dot(delta));
+        double energyBound = kappa*fabs(d-at)*2*tolerance + 0.5*kappa*(2*tolerance)*(2*tolerance);
+        double forceBound = kappa*2*tolerance + kappa*fabs(d-at)*4*tolerance/(d-2*tolerance);
+        ASSERT(fabs(states[0].getPotentialEnergy()-states[1].getPotentialEnergy()) <= energyBound*(1+1e-6)+1e-4);
+        for (int j = 0; j < numParticles; j++) {
+            Vec3 error = states[0].getForces()[j]-states[1].getForces()[j];
+            ASSERT(sqrt(error.dot(error)) <= forceBound*(1+1e-6)+1e-3);
+        }
+    }
+    ASSERT_EQUAL(2, storage->getCounters()[PlumedValueStorage::NumCalculations]);
+    ASSERT_EQUAL(numTrials, storage->getCounters()[PlumedValueStorage::ReusedCalculations]);
+
+    // Moving a used atom farther than the tolerance makes PLUMED compute the bias again.
+
+    vector<Vec3> positions = initialPositions;
+    positions[2] += Vec3(2*tolerance, 0, 0);
+    contexts[1]->setPositions(positions);
+    contexts[0]->setPositions(positions);
+    ASSERT_EQUAL_TOL(contexts[0]->getState(State::Energy).getPotentialEnergy(), contexts[1]->getState(State::Energy).getPotentialEnergy(), 1e-5);
+    ASSERT_EQUAL(3, storage->getCounters()[PlumedValueStorage::NumCalculations]);
+
+    // PLUMED is still updated at every step while the results are reused, so a value is printed for each step after
+    // the first.
+
+    PlumedForce* plumed = new PlumedForce("d: DISTANCE ATOMS=1,2\n"
+                                          "RESTRAINT ARG=d AT=0.5 KAPPA=100\n"
+                                          "PRINT ARG=d FILE=COLVAR.reuse", MPI_COMM_SELF, MPI_COMM_SELF);
+    plumed->setReuseTolerance(tolerance);
+    System system;
+    system.addParticle(1000.0);
+    system.addParticle(1000.0);
+    system.addForce(plumed);
+    VerletIntegrator integ(0.001);
+    unique_ptr<Context> context(new Context(system, integ, Platform::getPlatformByName("OpenCL")));
+    context->setPositions({Vec3(), Vec3(0.6, 0, 0)});
+    integ.step(20);
+    storage = plumed->getValueStorage(*context);
+    ASSERT(storage->getCounters()[PlumedValueStorage::ReusedCalculations] > 0);
+    context.reset();
+    ifstream colvar("COLVAR.reuse.0");
+    string line;
+    int numLines = 0;
+    while (getline(colvar, line))
+        if (line[0] != '#')
+            numLines++;
+    ASSERT_EQUAL(19, numLines);
+}
+
+void testReuseTimeDependentBias() {
+    // A METAD adds a hill at every update, and a MOVINGRESTRAINT moves at every step.  Step a Context that reuses
+    // results alongside one that does not, and check that their energies match at every step.  Results may still be
+    // reused within a step.
+
+    const double tolerance = 0.01;
+    const int numSteps = 10;
+    const vector<string> scripts = {"d: DISTANCE ATOMS=1,2\n"
+                                    "METAD ARG=d SIGMA=0.1 HEIGHT=1 PACE=1 FILE=HILLS.reuse",
+                                    "d: DISTANCE ATOMS=1,2\n"
+                                    "MOVINGRESTRAINT ARG=d STEP0=0 AT0=0.5 KAPPA0=100 STEP1=10 AT1=0.7 LABEL=m"};
+    for (const string& script : scripts) {
+        vector<unique_ptr<System> > systems;
+        vector<unique_ptr<VerletIntegrator> > integrators;
+        vector<unique_ptr<Context> > contexts;
+        vector<PlumedForce*> forces;
+        for (int i = 0; i < 2; i++) {
+            systems.push_back(unique_ptr<System>(new System()));
+            systems[i]->addParticle(1000.0);
+            systems[i]->addParticle(1000.0);
+            PlumedForce* plumed = new PlumedForce(script+to_string(i), MPI_COMM_SELF, MPI_COMM_SELF);
+            if (i == 1)
+                plumed->setReuseTolerance(tolerance);
+            systems[i]->addForce(plumed);
+            forces.push_back(plumed);
+            integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.001)));
+            contexts.push_back(unique_ptr<Context>(new Context(*systems[i], *integrators[i], Platform::getPlatformByName("OpenCL"))));
+            contexts[i]->setPositions({Vec3(), Vec3(0.6, 0, 0)});
+        }
+        vector<double> energies[2];
+        for (int i = 0; i < 2; i++)
+            for (int step = 0; step < numSteps; step++) {
+                integrators[i]->step(1);
+                for (int j = 0; j < 2; j++)
+                    energies[i].push_back(contexts[i]->getState(State::Energy).getPotentialEnergy());
+            }
+        for (int j = 0; j < energies[0].size(); j++)
+            ASSERT_EQUAL_TOL(energies[0][j], energies[1][j], 1e-5);
+        ASSERT(energies[0].back() != energies[0][0]);
+        ASSERT(forces[1]->getValueStorage(*contexts[1])->getCounters()[PlumedValueStorage::ReusedCalculations] > 0);
+    }
+    remove("HILLS.reuse0.0");
+    remove("HILLS.reuse1.0");
+}
+
 int main(int argc, char* argv[]) {
     try {
         registerPlumedOpenCLKernelFactories();
@@ -284,7 +847,14 @@ int main(int argc, char* argv[]) {
         testWellTemperedMetadynamics();
         testMassesCharges();
         testScript();
-
+        testCollectiveVariables();
+        testConcurrentContexts();
+        testNativeMetadynamics();
+        testDeviceContactVariables();
+        testSharedCoordinateExport();
+        testMultipleTimeStep();
+        testReuseTolerance();
+        testReuseTimeDependentBias();
     }
     catch(const std::exception& e) {
         std::cout << "exception: " << e.what() << std::endl;
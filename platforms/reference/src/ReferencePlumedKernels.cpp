@@ -33,11 +33,15 @@
 #include "ReferencePlumedKernels.h"
 #include "PlumedForce.h"
 #include "openmm/OpenMMException.h"
-#include "openmm/NonbondedForce.h"
+#include "internal/PlumedForceImpl.h"
+#include "internal/PlumedHardwareCounters.h"
+#include "internal/PlumedThreadLimit.h"
+#include "internal/PlumedTracer.h"
 #include "openmm/internal/ContextImpl.h"
 #include "openmm/reference/RealVec.h"
 #include "openmm/reference/ReferencePlatform.h"
 #include "openmm/reference/SimTKOpenMMRealType.h"
+#include <chrono>
 #include <cstring>
 #include <iostream>
 
@@ -60,120 +64,278 @@ static RealVec* extractBoxVectors(ContextImpl& context) {
     return (RealVec*) data->periodicBoxVectors;
 }
 
-ReferenceCalcPlumedForceKernel::ReferenceCalcPlumedForceKernel(std::string name, const OpenMM::Platform& platform, OpenMM::ContextImpl& contextImpl) : CalcPlumedForceKernel(name, platform), contextImpl(contextImpl), hasInitialized(false), lastStepIndex(0) {
+ReferenceCalcPlumedForceKernel::ReferenceCalcPlumedForceKernel(std::string name, const OpenMM::Platform& platform, OpenMM::ContextImpl& contextImpl) : CalcPlumedForceKernel(name, platform), contextImpl(contextImpl), hasInitialized(false), lastStepIndex(0), storage(new PlumedValueStorage(0)), useHardwareCounters(false), countCalculationEvents(false), deterministic(false) {
 }
 
 ReferenceCalcPlumedForceKernel::~ReferenceCalcPlumedForceKernel() {
-    if (hasInitialized)
-        plumed_finalize(plumedmain);
+    if (hasInitialized) {
+        lock_guard<mutex> guard(PlumedForceImpl::getInitializationLock());
+        plumedmain.finalize();
+    }
 }
 
 void ReferenceCalcPlumedForceKernel::initialize(const System& system, const PlumedForce& force) {
     // Construct and initialize the PLUMED interface object.
-    plumedmain = plumed_create();
+    PlumedTraceSpan span("initialize");
+    lock_guard<mutex> guard(PlumedForceImpl::getInitializationLock());
+    PlumedForceImpl::initializeMPI();
+    const vector<string>& labels = force.getCollectiveVariables();
+    storage.reset(new PlumedValueStorage(labels.size()));
+
+    // Prepare to count hardware events.  Those the system does not allow to count are marked with -1, as are those
+    // of PLUMED's computation when it may run on several threads.
+
+    useHardwareCounters = force.getUseHardwareCounters();
+    deterministic = force.getDeterministic();
+    countCalculationEvents = (useHardwareCounters && (deterministic || PlumedThreadLimit::getDefaultNumThreads() == 1));
+    if (useHardwareCounters) {
+        PlumedHardwareCounters::initializeCounters(storage->getCounters()+PlumedValueStorage::CalculationCycles, countCalculationEvents);
+        PlumedHardwareCounters::initializeCounters(storage->getCounters()+PlumedValueStorage::TransferCycles);
+    }
+
+    // Record the particle masses and charges.  Masses set on the force are shared with it, not copied.
+
+    masses = PlumedForceImpl::getParticleMasses(system, force);
+    charges = PlumedForceImpl::getParticleCharges(system);
+
+    // Which step each computation belongs to depends on when the integrator computes the forces.
+
+    schedule.reset(new PlumedStepSchedule(contextImpl.getIntegrator(), force.getForceGroup()));
+
+    // Metadynamics the plugin supports itself does not need PLUMED at all.
+
+    metadynamics = PlumedMetadynamics::create(force, system, contextImpl.getIntegrator().getStepSize());
+    if (metadynamics)
+        return;
+    plumedmain.create();
+    PlumedTraceSpan mpiSpan("GREX init", "mpi");
     int intra_comm_rank;
     MPI_Comm intra_comm = force.getIntracom();
     MPI_Comm inter_comm = force.getIntercom();
     MPI_Comm_rank(intra_comm, &intra_comm_rank);
-    MPI_Init(NULL, NULL);
     if (intra_comm_rank == 0)
-        plumed_cmd(plumedmain, "GREX setMPIIntercomm", &inter_comm);
-    plumed_cmd(plumedmain, "GREX setMPIIntracomm", &intra_comm);
-    plumed_cmd(plumedmain, "GREX init");
-    plumed_cmd(plumedmain, "setMPIComm", &intra_comm);
+        plumedmain.cmd("GREX setMPIIntercomm", &inter_comm);
+    plumedmain.cmd("GREX setMPIIntracomm", &intra_comm);
+    plumedmain.cmd("GREX init");
+    plumedmain.cmd("setMPIComm", &intra_comm);
+    mpiSpan.end();
+    if (force.getLoadBalanceReportInterval() > 0 && intra_comm_rank == 0)
+        loadBalance.reset(new PlumedLoadBalanceMonitor(inter_comm, force.getLoadBalanceReportInterval(), force.getLoadBalanceReportFile()));
     hasInitialized = true;
     int apiVersion;
-    plumed_cmd(plumedmain, "getApiVersion", &apiVersion);
+    plumedmain.cmd("getApiVersion", &apiVersion);
     if (apiVersion < 4)
         throw OpenMMException("Unsupported API version.  Upgrade PLUMED to a newer version.");
     int precision = 8;
-    plumed_cmd(plumedmain, "setRealPrecision", &precision);
+    plumedmain.cmd("setRealPrecision", &precision);
     double conversion = 1.0;
-    plumed_cmd(plumedmain, "setMDEnergyUnits", &conversion);
-    plumed_cmd(plumedmain, "setMDLengthUnits", &conversion);
-    plumed_cmd(plumedmain, "setMDTimeUnits", &conversion);
-    plumed_cmd(plumedmain, "setMDEngine", "OpenMM");
-    plumed_cmd(plumedmain, "setLog", force.getLogStream());
+    plumedmain.cmd("setMDEnergyUnits", &conversion);
+    plumedmain.cmd("setMDLengthUnits", &conversion);
+    plumedmain.cmd("setMDTimeUnits", &conversion);
+    plumedmain.cmd("setMDEngine", "OpenMM");
+    logStream = force.getSharedLogStream();
+    plumedmain.cmd("setLog", logStream.get());
     int numParticles = system.getNumParticles();
-    plumed_cmd(plumedmain, "setNatoms", &numParticles);
+    plumedmain.cmd("setNatoms", &numParticles);
     double dt = contextImpl.getIntegrator().getStepSize();
-    plumed_cmd(plumedmain, "setTimestep", &dt);
+    plumedmain.cmd("setTimestep", &dt);
     double kT = force.getTemperature() * BOLTZ;
     if (kT >= 0.0)
-        plumed_cmd(plumedmain, "setKbT", &kT);
+        plumedmain.cmd("setKbT", &kT);
     int restart = force.getRestart();
-    plumed_cmd(plumedmain, "setRestart", &restart);
-    plumed_cmd(plumedmain, "init", NULL);
+    plumedmain.cmd("setRestart", &restart);
+    plumedmain.cmd("init");
+
+    // COORDINATION and CONTACTMAP actions the plugin computes itself are replaced by EXTRACV in the script.
+
+    contacts = PlumedContactVariables::create(force, system);
+    const string& script = (contacts ? contacts->getScript() : force.getScript());
+    if (contacts) {
+        contactValues.resize(contacts->getNumVariables());
+        contactForces.resize(contacts->getNumVariables());
+    }
     if(apiVersion > 7) {
-        plumed_cmd(plumedmain, "readInputLines", force.getScript().c_str());
+        plumedmain.cmd("readInputLines", script.c_str());
     } else {
         // NOTE: the comments and line continuation does not works
         //       (https://github.com/plumed/plumed2/issues/571)
         // TODO: remove this when PLUMED 2.6 support is dropped
-        vector<char> scriptChars(force.getScript().size()+1);
-        strcpy(&scriptChars[0], force.getScript().c_str());
+        vector<char> scriptChars(script.size()+1);
+        strcpy(&scriptChars[0], script.c_str());
         char* line = strtok(&scriptChars[0], "\r\n");
         while (line != NULL) {
-            plumed_cmd(plumedmain, "readInputLine", line);
+            plumedmain.cmd("readInputLine", line);
             line = strtok(NULL, "\r\n");
         }
     }
     usesPeriodic = system.usesPeriodicBoundaryConditions();
 
-    // Record the particle masses.
-
-    masses.resize(numParticles);
-    const auto& plumedMasses = force.getMasses();
-    if (plumedMasses.size() == 0) // User System masses
-        for (int i = 0; i < numParticles; i++)
-            masses[i] = system.getParticleMass(i);
-    else if (plumedMasses.size() == numParticles) // User PLUMED masses
-        masses = plumedMasses;
-    else
-        throw OpenMMException("The number of PLUMED masses is different from the number of particles!");
-
-    // If there's a NonbondedForce, get charges from it.
-
-    for (int j = 0; j < system.getNumForces(); j++) {
-        const NonbondedForce* nonbonded = dynamic_cast<const NonbondedForce*>(&system.getForce(j));
-        if (nonbonded != NULL) {
-            charges.resize(numParticles);
-            double sigma, epsilon;
-            for (int i = 0; i < numParticles; i++)
-                nonbonded->getParticleParameters(i, charges[i], sigma, epsilon);
-        }
+    // Results may only be reused if no other replica takes part in the calculation.
+
+    int numReplicas = 1;
+    if (intra_comm_rank == 0)
+        MPI_Comm_size(inter_comm, &numReplicas);
+    MPI_Bcast(&numReplicas, 1, MPI_INT, 0, intra_comm);
+    if (force.getReuseTolerance() > 0 && numReplicas == 1 && !contacts) {
+        reuse.reset(new PlumedReuseCheck(force.getReuseTolerance(), force.getScript()));
+        plumedForces.resize(numParticles);
     }
+
+    // Ask PLUMED to store the requested values every time it computes them.
+
+    for (int i = 0; i < labels.size(); i++)
+        plumedmain.cmd(("setMemoryForData "+labels[i]).c_str(), storage->getValues()+i);
 }
 
 double ReferenceCalcPlumedForceKernel::execute(ContextImpl& context, bool includeForces, bool includeEnergy) {
+    PlumedTraceSpan span("execute");
+
     // Pass the current state to PLUMED.
 
-    ReferencePlatform::PlatformData* data = reinterpret_cast<ReferencePlatform::PlatformData*>(context.getPlatformData());
-    int step = data->stepCount;
-    plumed_cmd(plumedmain, "setStep", &step);
-    plumed_cmd(plumedmain, "setMasses", &masses[0]);
-    if (charges.size() > 0)
-        plumed_cmd(plumedmain, "setCharges", &charges[0]);
+    bool update;
+    int step = getStep(context, update);
+    if (metadynamics)
+        return executeMetadynamics(context, step, update);
+    PlumedThreadLimit threadLimit(plumedmain, deterministic);
+    plumedmain.cmd("setStep", &step);
     vector<RealVec>& pos = extractPositions(context);
-    plumed_cmd(plumedmain, "setPositions", &pos[0][0]);
     vector<RealVec>& force = extractForces(context);
-    plumed_cmd(plumedmain, "setForces", &force[0][0]);
+    double* counters = storage->getCounters();
+    if (reuse) {
+        // Ask PLUMED which atoms the actions active at this step use.  If they barely moved since PLUMED last
+        // computed the bias, add the same forces again and only update PLUMED.
+
+        {
+            PlumedTraceSpan span("prepareDependencies", "plumed");
+            plumedmain.cmd("prepareDependencies");
+            int numAtoms;
+            const int* atoms;
+            plumedmain.cmd("createFullList", &numAtoms);
+            plumedmain.cmd("getFullList", &atoms);
+            neededAtoms.assign(atoms, atoms+numAtoms);
+            plumedmain.cmd("clearFullList");
+        }
+        if (reuse->canReuse(neededAtoms, pos.data(), usesPeriodic ? extractBoxVectors(context) : NULL, step)) {
+            for (int i = 0; i < force.size(); i++)
+                force[i] += plumedForces[i];
+            if (update) {
+                PlumedTraceSpan span("update", "plumed");
+                plumedmain.cmd("update");
+                reuse->updated();
+            }
+            counters[PlumedValueStorage::ReusedCalculations]++;
+            return storage->getBias();
+        }
+        plumedForces.assign(plumedForces.size(), Vec3());
+    }
+    plumedmain.cmd("setMasses", masses->data());
+    if (charges.size() > 0)
+        plumedmain.cmd("setCharges", &charges[0]);
+    plumedmain.cmd("setPositions", &pos[0][0]);
+    plumedmain.cmd("setForces", reuse ? &plumedForces[0][0] : &force[0][0]);
     if (usesPeriodic) {
         RealVec* boxVectors = extractBoxVectors(context);
-        plumed_cmd(plumedmain, "setBox", &boxVectors[0][0]);
+        plumedmain.cmd("setBox", &boxVectors[0][0]);
     }
     double virial[9];
-    plumed_cmd(plumedmain, "setVirial", &virial[0], 9);
+    plumedmain.cmd("setVirial", &virial[0], 9);
+    if (contacts) {
+        // Pass the values of the variables computed by the plugin, and collect the forces PLUMED applies on them.
+
+        contacts->computeValues(&pos[0][0], usesPeriodic ? &extractBoxVectors(context)[0][0] : NULL, &contactValues[0]);
+        for (int i = 0; i < contacts->getNumVariables(); i++) {
+            contactForces[i] = 0.0;
+            plumedmain.cmd(("setExtraCV "+contacts->getVariableName(i)).c_str(), &contactValues[i]);
+            plumedmain.cmd(("setExtraCVForce "+contacts->getVariableName(i)).c_str(), &contactForces[i]);
+        }
+    }
 
     // Calculate the forces and energy.
 
-    plumed_cmd(plumedmain, "prepareCalc", NULL);
-    plumed_cmd(plumedmain, "performCalcNoUpdate", NULL);
-    if (step != lastStepIndex) {
-        plumed_cmd(plumedmain, "update", NULL);
-        lastStepIndex = step;
+    if (loadBalance && update)
+        counters[PlumedValueStorage::ReplicaWaitTime] += loadBalance->synchronize(step);
+    auto calcStart = chrono::steady_clock::now();
+    PlumedHardwareCounterScope calcEvents(countCalculationEvents ? counters+PlumedValueStorage::CalculationCycles : NULL);
+    if (reuse) {
+        // The dependencies are already prepared.
+
+        PlumedTraceSpan span("shareData", "plumed");
+        plumedmain.cmd("shareData");
+    }
+    else {
+        PlumedTraceSpan span("prepareCalc", "plumed");
+        plumedmain.cmd("prepareCalc");
+    }
+    if (update) {
+        // performCalc also runs the update and fills the buffers registered with setMemoryForData.
+        PlumedTraceSpan span("performCalc", "plumed");
+        plumedmain.cmd("performCalc");
     }
-    double energy = 0;
-    plumed_cmd(plumedmain, "getBias", &energy);
-    return energy;
+    else {
+        PlumedTraceSpan span("performCalcNoUpdate", "plumed");
+        plumedmain.cmd("performCalcNoUpdate");
+    }
+    if (contacts)
+        contacts->addForces(&contactForces[0], &force[0][0]);
+    if (reuse) {
+        reuse->record(neededAtoms, pos.data(), usesPeriodic ? extractBoxVectors(context) : NULL, step);
+        if (update)
+            reuse->updated();
+        for (int i = 0; i < force.size(); i++)
+            force[i] += plumedForces[i];
+    }
+    calcEvents.end();
+    counters[PlumedValueStorage::NumCalculations]++;
+    counters[PlumedValueStorage::CalculationTime] += chrono::duration<double>(chrono::steady_clock::now()-calcStart).count();
+    plumedmain.cmd("getBias", &storage->getBias());
+    return storage->getBias();
+}
+
+double ReferenceCalcPlumedForceKernel::executeMetadynamics(ContextImpl& context, int step, bool update) {
+    double* counters = storage->getCounters();
+    auto calcStart = chrono::steady_clock::now();
+    PlumedHardwareCounterScope calcEvents(countCalculationEvents ? counters+PlumedValueStorage::CalculationCycles : NULL);
+    storage->getBias() = metadynamics->calcForcesAndEnergy(&extractPositions(context)[0][0], &extractForces(context)[0][0], step, update);
+    if (update)
+        metadynamics->getRecordedValues(storage->getValues());
+    calcEvents.end();
+    counters[PlumedValueStorage::NumCalculations]++;
+    counters[PlumedValueStorage::CalculationTime] += chrono::duration<double>(chrono::steady_clock::now()-calcStart).count();
+    return storage->getBias();
+}
+
+void ReferenceCalcPlumedForceKernel::beginStep(ContextImpl& context) {
+    schedule->beginStep(context.getStepCount());
+}
+
+int ReferenceCalcPlumedForceKernel::getStep(ContextImpl& context, bool& update) {
+    ReferencePlatform::PlatformData* data = reinterpret_cast<ReferencePlatform::PlatformData*>(context.getPlatformData());
+    int stepCount = data->stepCount;
+    bool positionsChanged = false;
+    if (schedule->getComputationsAfterMoving() > 0) {
+        // Remember the positions, so the first computation of the next step can tell whether the integrator moved
+        // the particles before it.
+
+        vector<RealVec>& pos = extractPositions(context);
+        if (schedule->needsPositionCheck(stepCount))
+            positionsChanged = (lastPositions.size() > 0 && pos != lastPositions);
+        lastPositions = pos;
+    }
+    int step = schedule->getStep(stepCount, positionsChanged, update);
+    update = (update && step != lastStepIndex);
+    if (update)
+        lastStepIndex = step;
+    return step;
+}
+
+void ReferenceCalcPlumedForceKernel::getCollectiveVariableValues(vector<double>& values) const {
+    values.assign(storage->getValues(), storage->getValues()+storage->getNumValues());
+}
+
+double ReferenceCalcPlumedForceKernel::getBiasEnergy() const {
+    return storage->getBias();
+}
+
+shared_ptr<PlumedValueStorage> ReferenceCalcPlumedForceKernel::getValueStorage() const {
+    return storage;
 }
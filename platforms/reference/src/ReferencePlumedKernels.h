@@ -34,7 +34,13 @@
 
 #include "PlumedKernels.h"
 #include "openmm/Platform.h"
-#include "wrapper/Plumed.h"
+#include "internal/PlumedContactVariables.h"
+#include "internal/PlumedKernelHandle.h"
+#include "internal/PlumedLoadBalanceMonitor.h"
+#include "internal/PlumedMetadynamics.h"
+#include "internal/PlumedReuseCheck.h"
+#include "internal/PlumedStepSchedule.h"
+#include <memory>
 #include <vector>
 
 namespace PlumedPlugin {
@@ -62,6 +68,26 @@ public:
      * @return the potential energy due to the force
      */
     double execute(OpenMM::ContextImpl& context, bool includeForces, bool includeEnergy);
+    /**
+     * Record that the integrator is starting a time step.
+     *
+     * @param context        the context in which to execute this kernel
+     */
+    void beginStep(OpenMM::ContextImpl& context);
+    /**
+     * Get the values of the PLUMED values recorded during the most recent calculation.
+     *
+     * @param values     the values are stored into this
+     */
+    void getCollectiveVariableValues(std::vector<double>& values) const;
+    /**
+     * Get the bias energy computed by PLUMED during the most recent calculation.
+     */
+    double getBiasEnergy() const;
+    /**
+     * Get the storage into which the kernel records the bias, timing counters and PLUMED values.
+     */
+    std::shared_ptr<PlumedValueStorage> getValueStorage() const;
     /**
      * Copy changed parameters over to a context.
      *
@@ -70,11 +96,38 @@ public:
      */
     void copyParametersToContext(OpenMM::ContextImpl& context, const PlumedForce& force);
 private:
-    plumed plumedmain;
+    /**
+     * Compute the forces and energy with the plugin's own metadynamics instead of PLUMED.
+     */
+    double executeMetadynamics(OpenMM::ContextImpl& context, int step, bool update);
+    /**
+     * Get the PLUMED step of a computation and whether it runs the update.
+     */
+    int getStep(OpenMM::ContextImpl& context, bool& update);
+    // The log is declared before plumedmain, so it stays open until PLUMED has been finalized.
+    std::shared_ptr<FILE> logStream;
+    PlumedKernelHandle plumedmain;
     bool hasInitialized, usesPeriodic;
     OpenMM::ContextImpl& contextImpl;
     int lastStepIndex;
-    std::vector<double> masses, charges;
+    std::shared_ptr<const std::vector<double> > masses;
+    std::vector<double> charges;
+    std::shared_ptr<PlumedValueStorage> storage;
+    std::unique_ptr<PlumedLoadBalanceMonitor> loadBalance;
+    std::unique_ptr<PlumedMetadynamics> metadynamics;
+    std::unique_ptr<PlumedContactVariables> contacts;
+    std::unique_ptr<PlumedStepSchedule> schedule;
+    std::vector<OpenMM::Vec3> lastPositions;
+    // When results may be reused, PLUMED computes its forces into plumedForces, which are added to OpenMM's.
+    std::unique_ptr<PlumedReuseCheck> reuse;
+    std::vector<int> neededAtoms;
+    std::vector<OpenMM::Vec3> plumedForces;
+    std::vector<double> contactValues, contactForces;
+    bool useHardwareCounters;
+    // The counters only see the calling thread, so PLUMED's computation is only counted when it runs on one thread.
+    bool countCalculationEvents;
+    // A deterministic force runs PLUMED on one thread while it computes.
+    bool deterministic;
 };
 
 } // namespace PlumedPlugin
@@ -33,18 +33,37 @@
  * This tests the Reference implementation of PlumedForce.
  */
 
+#include "CalvadosSystemBuilder.h"
+#include "ExclusionFile.h"
+#include "PlumedAsyncStepper.h"
 #include "PlumedForce.h"
+#include "internal/PlumedHardwareCounters.h"
+#include "internal/PlumedReuseCheck.h"
+#include "internal/PlumedThreadLimit.h"
+#include "internal/PlumedTracer.h"
 #include "openmm/internal/AssertionUtilities.h"
 #include "openmm/Context.h"
+#include "openmm/CustomBondForce.h"
 #include "openmm/CustomExternalForce.h"
+#include "openmm/CustomIntegrator.h"
+#include "openmm/CustomNonbondedForce.h"
+#include "openmm/HarmonicBondForce.h"
 #include "openmm/LangevinIntegrator.h"
 #include "openmm/NonbondedForce.h"
 #include "openmm/Platform.h"
 #include "openmm/System.h"
+#include "openmm/VerletIntegrator.h"
 #include "openmm/reference/SimTKOpenMMRealType.h"
+#include "sfmt/SFMT.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 #include <mpi.h>
 
@@ -67,8 +86,8 @@ void testForce() {
     string script =
         "d: DISTANCE ATOMS=1,3\n"
         "BIASVALUE ARG=d";
-    MPI_Comm comm;
-    MPI_Comm comm2;
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
     PlumedForce* plumed = new PlumedForce(script, comm, comm2);
     system.addForce(plumed);
     LangevinIntegrator integ(300.0, 1.0, 1.0);
@@ -100,8 +119,8 @@ void testMetadynamics() {
     string script =
         "p: POSITION ATOM=1\n"
         "METAD ARG=p.x SIGMA=0.5 HEIGHT=0.1 PACE=1";
-    MPI_Comm comm;
-    MPI_Comm comm2;
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
     PlumedForce* plumed = new PlumedForce(script, comm, comm2);
     system.addForce(plumed);
     vector<Vec3> positions;
@@ -148,8 +167,8 @@ void testWellTemperedMetadynamics() {
     CustomExternalForce* external = new CustomExternalForce("x^2");
     external->addParticle(0);
     system.addForce(external);
-    MPI_Comm comm;
-    MPI_Comm comm2;
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
     PlumedForce* plumed = new PlumedForce(script, comm, comm2);
     plumed->setTemperature(temperatue); // This is tested here!
     system.addForce(plumed);
@@ -189,8 +208,8 @@ void testMassesCharges() {
 
     // Setup PLUMED to write the mass and chage of the particles to a file
     const string script = "DUMPMASSCHARGE ATOMS=@mdatoms FILE=mass_charge.txt";
-    MPI_Comm comm;
-    MPI_Comm comm2;
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
     PlumedForce* plumed = new PlumedForce(script, comm, comm2);
     system.addForce(plumed);
 
@@ -264,8 +283,8 @@ void testScript() {
                           "  # A comment in the middle\n"
                           "  STRIDE=10\n"
                           "...";
-    MPI_Comm comm;
-    MPI_Comm comm2;
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
     PlumedForce* plumed = new PlumedForce(script, comm, comm2);
     system.addForce(plumed);
 
@@ -277,6 +296,1030 @@ void testScript() {
     // If the parser fails, an exception is thrown during the context creation
 }
 
+void testCollectiveVariables() {
+    // Create a System that applies a force based on the distance between two atoms and record the distance.
+
+    const int numParticles = 4;
+    System system;
+    vector<Vec3> positions(numParticles);
+    for (int i = 0; i < numParticles; i++) {
+        system.addParticle(1.0);
+        positions[i] = Vec3(i, 0.1*i, -0.3*i);
+    }
+    string script =
+        "d: DISTANCE ATOMS=1,3\n"
+        "p: POSITION ATOM=2\n"
+        "BIASVALUE ARG=d";
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
+    PlumedForce* plumed = new PlumedForce(script, comm, comm2);
+    plumed->setCollectiveVariables({"d", "p.y"});
+    system.addForce(plumed);
+    LangevinIntegrator integ(300.0, 1.0, 1.0);
+    Platform& platform = Platform::getPlatformByName("Reference");
+    Context context(system, integ, platform);
+    context.setPositions(positions);
+
+    // PLUMED records the values when it is updated for a new step, so take one step and check the recorded values
+    // against the positions at which the force is then computed.
+
+    integ.step(1);
+    State state = context.getState(State::Positions | State::Energy);
+    positions = state.getPositions();
+    Vec3 delta = positions[0]-positions[2];
+    double dist = sqrt(delta.dot(delta));
+    vector<double> values;
+    plumed->getCollectiveVariableValues(context, values);
+    ASSERT_EQUAL(2, values.size());
+    ASSERT_EQUAL_TOL(dist, values[0], 1e-5);
+    ASSERT_EQUAL_TOL(positions[1][1], values[1], 1e-5);
+    ASSERT_EQUAL_TOL(dist, plumed->getBiasEnergy(context), 1e-5);
+
+    // The shared storage holds the same values and counts the calculations.
+
+    shared_ptr<PlumedValueStorage> storage = plumed->getValueStorage(context);
+    ASSERT_EQUAL(2, storage->getNumValues());
+    ASSERT_EQUAL(values[0], storage->getValues()[0]);
+    ASSERT_EQUAL(values[1], storage->getValues()[1]);
+    ASSERT_EQUAL(plumed->getBiasEnergy(context), storage->getBias());
+    double calculations = storage->getCounters()[PlumedValueStorage::NumCalculations];
+    ASSERT(calculations >= 2);
+    context.getState(State::Energy);
+    ASSERT_EQUAL(calculations+1, storage->getCounters()[PlumedValueStorage::NumCalculations]);
+}
+
+void testAsyncStepper() {
+    // Create a System whose bias is the distance between two atoms.
+
+    const int numParticles = 3;
+    System system;
+    vector<Vec3> positions(numParticles);
+    for (int i = 0; i < numParticles; i++) {
+        system.addParticle(1.0);
+        positions[i] = Vec3(i, 0.1*i, -0.3*i);
+    }
+    MPI_Comm comm = MPI_COMM_SELF;
+    MPI_Comm comm2 = MPI_COMM_SELF;
+    PlumedForce* plumed = new PlumedForce("d: DISTANCE ATOMS=1,3\nBIASVALUE ARG=d", comm, comm2);
+    plumed->setCollectiveVariables({"d"});
+    system.addForce(plumed);
+    VerletIntegrator integ(0.001);
+    Platform& platform = Platform::getPlatformByName("Reference");
+    Context context(system, integ, platform);
+    context.setPositions(positions);
+
+    // Take 22 steps with a stride of 5.  Four snapshots are taken, and the first one is dropped.
+
+    PlumedAsyncStepper stepper(context, *plumed, 5, 3);
+    ASSERT_EQUAL(3, stepper.getSnapshotSize());
+    stepper.start(22);
+    stepper.wait();
+    ASSERT(!stepper.isRunning());
+    ASSERT_EQUAL(22, context.getStepCount());
+    vector<double> snapshots;
+    ASSERT_EQUAL(3, stepper.readSnapshots(snapshots));
+    ASSERT_EQUAL(9, snapshots.size());
+    ASSERT_EQUAL(1, stepper.getNumDropped());
+    ASSERT_EQUAL(9.0, snapshots[0]);
+    ASSERT_EQUAL(14.0, snapshots[3]);
+    ASSERT_EQUAL(19.0, snapshots[6]);
+    for (int i = 0; i < 3; i++)
+        ASSERT_EQUAL_TOL(snapshots[3*i+1], snapshots[3*i+2], 1e-10);
+    ASSERT_EQUAL(0, stepper.readSnapshots(snapshots));
+
+    // The last snapshot of a run matches the values recorded by the force.
+
+    stepper.start(10);
+    stepper.wait();
+    snapshots.clear();
+    ASSERT_EQUAL(2, stepper.readSnapshots(snapshots));
+    vector<double> values;
+    plumed->getCollectiveVariableValues(context, values);
+    ASSERT_EQUAL(values[0], snapshots[5]);
+    ASSERT_EQUAL(plumed->getBiasEnergy(context), snapshots[4]);
+}
+
+void testCalvadosSystemBuilder() {
+    // Build two chains from a residue table.
+
+    ofstream table("calvados_residues.csv");
+    table << "three,one,MW,lambdas,sigmas,q\n";
+    table << "ALA,A,71.07,0.27,0.504,0\n";
+    table << "LYS,K,128.17,0.18,0.636,1\n";
+    table << "HIS,H,137.14,0.47,0.608,0\n";
+    table.close();
+    CalvadosSystemBuilder builder;
+    builder.loadResidueTable("calvados_residues.csv");
+    ASSERT_EQUAL(0, builder.addChain("KAKA"));
+    ASSERT_EQUAL(4, builder.addChain("H"));
+    ASSERT_EQUAL(5, builder.getNumParticles());
+    System* system = builder.createSystem();
+    ASSERT_EQUAL(5, system->getNumParticles());
+    ASSERT_EQUAL(3, system->getNumForces());
+    ASSERT_EQUAL_TOL(128.17+2, system->getParticleMass(0), 1e-10);
+    ASSERT_EQUAL_TOL(71.07, system->getParticleMass(1), 1e-10);
+    ASSERT_EQUAL_TOL(71.07+16, system->getParticleMass(3), 1e-10);
+    ASSERT_EQUAL_TOL(137.14+18, system->getParticleMass(4), 1e-10);
+    const HarmonicBondForce& bonds = dynamic_cast<const HarmonicBondForce&>(system->getForce(0));
+    const CustomNonbondedForce& yukawa = dynamic_cast<const CustomNonbondedForce&>(system->getForce(1));
+    const CustomNonbondedForce& ashbaugh = dynamic_cast<const CustomNonbondedForce&>(system->getForce(2));
+    ASSERT_EQUAL(3, bonds.getNumBonds());
+    ASSERT_EQUAL(3, yukawa.getNumExclusions());
+    ASSERT_EQUAL(3, ashbaugh.getNumExclusions());
+    ASSERT_EQUAL(1, ashbaugh.getForceGroup());
+    vector<double> params;
+    yukawa.getParticleParameters(4, params);
+    ASSERT_EQUAL_TOL(1.0/(1.0+pow(10.0, 7.4-6)), params[0], 1e-10);
+
+    // Place the first chain on a line at the bond length and the second one far away, and compare the energies.
+
+    vector<Vec3> positions;
+    for (int i = 0; i < 4; i++)
+        positions.push_back(Vec3(0.38*i, 0, 0));
+    positions.push_back(Vec3(0, 10, 0));
+    VerletIntegrator integ(0.001);
+    Context context(*system, integ, Platform::getPlatformByName("Reference"));
+    context.setPositions(positions);
+    double T = 298.0;
+    double RT = 8.3145*T*1e-3;
+    double epsw = 5321/T+233.76-0.9297*T+0.1417e-2*T*T-0.8292e-6*T*T*T;
+    double lB = 1.6021766*1.6021766/(4*M_PI*8.854188*epsw)*6.022*1000/RT;
+    double kappa = sqrt(8*M_PI*lB*0.2*6.022/10);
+    double charges[] = {2.0, 0.0, 1.0, -1.0};
+    double expected = 0.0;
+    for (int i = 0; i < 4; i++)
+        for (int j = i+2; j < 4; j++) {
+            double r = 0.38*(j-i);
+            expected += RT*lB*charges[i]*charges[j]*(exp(-r*kappa)/r-exp(-4.0*kappa)/4.0);
+        }
+    ASSERT_EQUAL_TOL(expected, context.getState(State::Energy, false, 1<<0).getPotentialEnergy(), 1e-5);
+    double sigmas[] = {0.636, 0.504, 0.636, 0.504};
+    double lambdas[] = {0.18, 0.27, 0.18, 0.27};
+    double eps = 4.184*0.2;
+    expected = 0.0;
+    for (int i = 0; i < 4; i++)
+        for (int j = i+2; j < 4; j++) {
+            double r = 0.38*(j-i);
+            double sigma = 0.5*(sigmas[i]+sigmas[j]);
+            double lambda = 0.5*(lambdas[i]+lambdas[j]);
+            double lj = 4*eps*(pow(sigma/r, 12)-pow(sigma/r, 6));
+            double shift = 4*eps*(pow(sigma/2.0, 12)-pow(sigma/2.0, 6));
+            if (r < pow(2.0, 1.0/6.0)*sigma)
+                expected += lj+(1-lambda)*eps-lambda*shift;
+            else
+                expected += lambda*(lj-shift);
+        }
+    ASSERT_EQUAL_TOL(expected, context.getState(State::Energy, false, 1<<1).getPotentialEnergy(), 1e-5);
+    delete system;
+}
+
+void testExclusionFile() {
+    // Write a list of pairs and read it back.
+
+    vector<pair<int, int> > pairs;
+    for (int i = 0; i < 9; i++)
+        pairs.push_back(make_pair(i, i+1));
+    pairs.push_back(make_pair(2, 7));
+    ExclusionFile::write("exclusions.bin", pairs);
+    ExclusionFile file("exclusions.bin");
+
+    // The file is little endian: the version, 1, starts with its low byte, as does the index of the last particle.
+
+    ifstream bytes("exclusions.bin", ios::binary);
+    vector<unsigned char> content((istreambuf_iterator<char>(bytes)), istreambuf_iterator<char>());
+    ASSERT_EQUAL(24+10*8, content.size());
+    ASSERT_EQUAL(1, content[8]);
+    ASSERT_EQUAL(0, content[11]);
+    ASSERT_EQUAL(7, content[content.size()-4]);
+    ASSERT_EQUAL(10, file.getNumPairs());
+    for (int i = 0; i < 10; i++) {
+        int p1, p2;
+        file.getPair(i, p1, p2);
+        ASSERT_EQUAL(pairs[i].first, p1);
+        ASSERT_EQUAL(pairs[i].second, p2);
+    }
+
+    // Apply it to a force that already excludes some of the pairs.
+
+    CustomNonbondedForce force("r");
+    for (int i = 0; i < 10; i++)
+        force.addParticle(vector<double>());
+    force.addExclusion(1, 0);
+    force.addExclusion(3, 4);
+    ASSERT_EQUAL(8, file.addExclusionsTo(force));
+    ASSERT_EQUAL(10, force.getNumExclusions());
+    ASSERT_EQUAL(0, file.addExclusionsTo(force));
+
+    // A pair that is out of range or excludes a particle from itself is rejected before any exclusion is added.
+
+    for (pair<int, int> invalidPair : {make_pair(3, 10), make_pair(5, 5)}) {
+        vector<pair<int, int> > invalidPairs = {make_pair(0, 5), invalidPair};
+        ExclusionFile::write("invalid_exclusions.bin", invalidPairs);
+        ExclusionFile invalidFile("invalid_exclusions.bin");
+        bool threw = false;
+        try {
+            invalidFile.addExclusionsTo(force);
+        }
+        catch (OpenMMException& ex) {
+            threw = true;
+        }
+        ASSERT(threw);
+        ASSERT_EQUAL(10, force.getNumExclusions());
+    }
+    remove("invalid_exclusions.bin");
+
+    // Files that are not exclusion lists are rejected.
+
+    ofstream("not_exclusions.bin") << "not an exclusion file at all";
+    bool threw = false;
+    try {
+        ExclusionFile invalid("not_exclusions.bin");
+    }
+    catch (OpenMMException& ex) {
+        threw = true;
+    }
+    ASSERT(threw);
+
+    // So are files whose header claims more pairs than they hold, including counts so large that the size of the
+    // pairs overflows.
+
+    for (uint64_t count : {11ULL, 1ULL<<61, ~0ULL}) {
+        fstream damaged("exclusions.bin", ios::in|ios::out|ios::binary);
+        damaged.seekp(16);
+        damaged.write((const char*) &count, sizeof(count));
+        damaged.close();
+        threw = false;
+        try {
+            ExclusionFile invalid("exclusions.bin");
+        }
+        catch (OpenMMException& ex) {
+            threw = true;
+        }
+        ASSERT(threw);
+    }
+}
+
+void testMassRepartitioning() {
+    // A methyl group with repartitioned hydrogens, one of them constrained and two bonded, plus a water whose
+    // hydrogens were left alone.  With hmass=4 the carbon is left lighter than its hydrogens.
+
+    const double hydrogenMass = 1.007947;
+    for (double hmass : {3.0, 4.0}) {
+        System system;
+        system.addParticle(12.011-3*(hmass-hydrogenMass));
+        for (int i = 0; i < 3; i++)
+            system.addParticle(hmass);
+        system.addParticle(15.999);
+        system.addParticle(hydrogenMass);
+        system.addParticle(hydrogenMass);
+        system.addConstraint(0, 1, 0.1);
+        HarmonicBondForce* bonds = new HarmonicBondForce();
+        bonds->addBond(2, 0, 0.1, 1000.0);
+        bonds->addBond(0, 3, 0.1, 1000.0);
+        bonds->addBond(4, 5, 0.1, 1000.0);
+        bonds->addBond(4, 6, 0.1, 1000.0);
+        system.addForce(bonds);
+        PlumedForce force("", MPI_COMM_SELF, MPI_COMM_SELF);
+        force.setMassesFromTopologyRepartitioning(system, hmass);
+        const vector<double>& masses = force.getMasses();
+        ASSERT_EQUAL(7, masses.size());
+        ASSERT_EQUAL_TOL(12.011, masses[0], 1e-10);
+        for (int i = 1; i < 4; i++)
+            ASSERT_EQUAL_TOL(hydrogenMass, masses[i], 1e-10);
+        for (int i = 4; i < 7; i++)
+            ASSERT_EQUAL(system.getParticleMass(i), masses[i]);
+
+        // Copies of the force share the masses.
+
+        PlumedForce copy(force);
+        ASSERT(copy.getSharedMasses() == force.getSharedMasses());
+    }
+}
+
+void testTrace() {
+    // Record a trace of a few steps and check that it contains the phases of the calculation.
+
+    System system;
+    for (int i = 0; i < 3; i++)
+        system.addParticle(1.0);
+    system.addForce(new PlumedForce("d: DISTANCE ATOMS=1,3\nBIASVALUE ARG=d", MPI_COMM_SELF, MPI_COMM_SELF));
+    VerletIntegrator integ(0.001);
+    Platform& platform = Platform::getPlatformByName("Reference");
+    // The trace goes to the temporary directory (TMPDIR, or TEMP on Windows) and is deleted once it has been read.
+
+    const char* tempDir = getenv("TMPDIR");
+    if (tempDir == NULL)
+        tempDir = getenv("TEMP");
+    string path = string(tempDir == NULL ? "/tmp" : tempDir)+"/plumed_trace_"+to_string(PlumedTracer::now())+".json";
+    PlumedTracer::start(path);
+    ASSERT(PlumedTracer::isEnabled());
+    Context context(system, integ, platform);
+    context.setPositions({Vec3(0, 0, 0), Vec3(1, 0, 0), Vec3(1, 1, 0)});
+    integ.step(3);
+    PlumedTracer::stop();
+    ASSERT(!PlumedTracer::isEnabled());
+    integ.step(1);
+    ifstream file(path);
+    stringstream buffer;
+    buffer << file.rdbuf();
+    file.close();
+    remove(path.c_str());
+    string trace = buffer.str();
+    ASSERT(trace.find("\"traceEvents\"") != string::npos);
+    ASSERT(trace.find("\"name\":\"initialize\"") != string::npos);
+    ASSERT(trace.find("\"name\":\"GREX init\",\"cat\":\"mpi\"") != string::npos);
+    ASSERT(trace.find("\"name\":\"performCalc\"") != string::npos);
+    int numExecute = 0;
+    for (size_t pos = trace.find("\"name\":\"execute\""); pos != string::npos; pos = trace.find("\"name\":\"execute\"", pos+1))
+        numExecute++;
+    ASSERT_EQUAL(3, numExecute); // One calculation per step taken while tracing
+}
+
+void testLoadBalanceReport() {
+    // With a single replica there is never anything to wait for, but the report is still written.
+
+    System system;
+    for (int i = 0; i < 3; i++)
+        system.addParticle(1.0);
+    PlumedForce* plumed = new PlumedForce("d: DISTANCE ATOMS=1,3\nBIASVALUE ARG=d", MPI_COMM_SELF, MPI_COMM_SELF);
+    ASSERT_EQUAL(0, plumed->getLoadBalanceReportInterval());
+    plumed->setLoadBalanceReport(5, "plumed_balance.txt");
+    ASSERT_EQUAL(5, plumed->getLoadBalanceReportInterval());
+    ASSERT_EQUAL("plumed_balance.txt", plumed->getLoadBalanceReportFile());
+    system.addForce(plumed);
+    VerletIntegrator integ(0.001);
+    Platform& platform = Platform::getPlatformByName("Reference");
+    Context context(system, integ, platform);
+    context.setPositions({Vec3(0, 0, 0), Vec3(1, 0, 0), Vec3(1, 1, 0)});
+    integ.step(12);
+    ifstream file("plumed_balance.txt");
+    string line;
+    vector<string> lines;
+    while (getline(file, line))
+        lines.push_back(line);
+    ASSERT_EQUAL(5, lines.size()); // A header, and two summaries of one replica and of all of them
+    ASSERT(lines[0][0] == '#');
+    for (int i = 1; i < 5; i++) {
+        stringstream columns(lines[i]);
+        int step;
+        string replica;
+        double computeMean, computeMin, computeMax, waitMean, waitFraction;
+        columns >> step >> replica >> computeMean >> computeMin >> computeMax >> waitMean >> waitFraction;
+        ASSERT_EQUAL(i < 3 ? 6 : 11, step);
+        ASSERT_EQUAL(i%2 == 1 ? "0" : "all", replica);
+        ASSERT(computeMin <= computeMean && computeMean <= computeMax);
+        ASSERT(waitFraction >= 0 && waitFraction <= 1);
+    }
+    ASSERT(plumed->getValueStorage(context)->getCounters()[PlumedValueStorage::ReplicaWaitTime] >= 0);
+}
+
+void testHardwareCounters() {
+    // Each event is either counted or, if the system does not allow it, reported as -1.
+
+    System system;
+    for (int i = 0; i < 3; i++)
+        system.addParticle(1.0);
+    PlumedForce* plumed = new PlumedForce("d: DISTANCE ATOMS=1,3\nBIASVALUE ARG=d", MPI_COMM_SELF, MPI_COMM_SELF);
+    ASSERT(!plumed->getUseHardwareCounters());
+    plumed->setUseHardwareCounters(true);
+    ASSERT(plumed->getUseHardwareCounters());
+    system.addForce(plumed);
+    VerletIntegrator integ(0.001);
+    Platform& platform = Platform::getPlatformByName("Reference");
+    Context context(system, integ, platform);
+    context.setPositions({Vec3(0, 0, 0), Vec3(1, 0, 0), Vec3(1, 1, 0)});
+    integ.step(5);
+    const double* counters = plumed->getValueStorage(context)->getCounters();
+    for (int i = 0; i < PlumedHardwareCounters::NumEvents; i++) {
+        bool available = PlumedHardwareCounters::isAvailable((PlumedHardwareCounters::Event) i);
+        if (available && i != PlumedHardwareCounters::CacheMisses)
+            ASSERT(counters[PlumedValueStorage::CalculationCycles+i] > 0);
+        if (!available)
+            ASSERT_EQUAL(-1.0, counters[PlumedValueStorage::CalculationCycles+i]);
+        ASSERT_EQUAL(available ? 0.0 : -1.0, counters[PlumedValueStorage::TransferCycles+i]);
+    }
+
+    // The OpenMP threads of PLUMED are not counted, so its computation is not reported when it may use several.
+
+    const char* oldSetting = getenv("PLUMED_NUM_THREADS");
+    string oldThreads = (oldSetting == NULL ? "" : oldSetting);
+    setenv("PLUMED_NUM_THREADS", "4", 1);
+    for (int deterministic = 0; deterministic < 2; deterministic++) {
+        System system;
+        for (int i = 0; i < 3; i++)
+            system.addParticle(1.0);
+        PlumedForce* plumed = new PlumedForce("d: DISTANCE ATOMS=1,3\nBIASVALUE ARG=d", MPI_COMM_SELF, MPI_COMM_SELF);
+        plumed->setUseHardwareCounters(true);
+        plumed->setDeterministic(deterministic);
+        system.addForce(plumed);
+        VerletIntegrator integ(0.001);
+        Context context(system, integ, platform);
+        context.setPositions({Vec3(0, 0, 0), Vec3(1, 0, 0), Vec3(1, 1, 0)});
+        integ.step(5);
+        const double* counters = plumed->getValueStorage(context)->getCounters();
+        for (int i = 0; i < PlumedHardwareCounters::NumEvents; i++) {
+            bool available = PlumedHardwareCounters::isAvailable((PlumedHardwareCounters::Event) i);
+            if (!deterministic || !available) {
+                ASSERT_EQUAL(-1.0, counters[PlumedValueStorage::CalculationCycles+i]);
+            }
+            else if (i != PlumedHardwareCounters::CacheMisses) {
+                ASSERT(counters[PlumedValueStorage::CalculationCycles+i] > 0);
+            }
+        }
+    }
+    if (oldSetting == NULL)
+        unsetenv("PLUMED_NUM_THREADS");
+    else
+        setenv("PLUMED_NUM_THREADS", oldThreads.c_str(), 1);
+}
+
+static string readLog(const string& path) {
+    ifstream file(path);
+    stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+static void computeDeterministicForce() {
+    System system;
+    system.addParticle(1.0);
+    PlumedForce* plumed = new PlumedForce("", MPI_COMM_SELF, MPI_COMM_SELF);
+    plumed->setDeterministic(true);
+    system.addForce(plumed);
+    VerletIntegrator integ(1.0);
+    Context context(system, integ, Platform::getPlatformByName("Reference"));
+    context.setPositions(vector<Vec3>(1));
+    context.getState(State::Forces);
+}
+
+void testDeterministic() {
+    // PLUMED shares its number of threads across the process, and a deterministic force restores PLUMED_NUM_THREADS
+    // when it finishes computing.  Use that to give PLUMED four threads, then run a Context in the default mode, two
+    // in deterministic mode, and one more in the default mode.  PLUMED reports its number of threads in the log of
+    // every instance it initializes, so the last log shows that the deterministic forces restored it.
+
+    const char* oldSetting = getenv("PLUMED_NUM_THREADS");
+    string oldThreads = (oldSetting == NULL ? "" : oldSetting);
+    setenv("PLUMED_NUM_THREADS", "4", 1);
+    ASSERT_EQUAL(4, PlumedThreadLimit::getDefaultNumThreads());
+    computeDeterministicForce();
+    const char* tempDir = getenv("TMPDIR");
+    string logPath = string(tempDir == NULL ? "/tmp" : tempDir)+"/plumed_deterministic_"+to_string(PlumedTracer::now())+".log";
+    const int numParticles = 200;
+    vector<Vec3> positions(numParticles);
+    for (int i = 0; i < numParticles; i++)
+        positions[i] = Vec3(sin(1.3*i), cos(0.7*i), sin(0.37*i+1.0))*1.5;
+    string script =
+        "c: COORDINATION GROUPA=1-100 GROUPB=101-200 R_0=0.3\n"
+        "RESTRAINT ARG=c AT=10 KAPPA=1";
+    vector<vector<Vec3> > forces;
+    vector<double> values;
+    vector<string> logs;
+    for (int run = 0; run < 4; run++) {
+        bool deterministic = (run == 1 || run == 2);
+        System system;
+        for (int i = 0; i < numParticles; i++)
+            system.addParticle(1.0);
+        PlumedForce* plumed = new PlumedForce(script, MPI_COMM_SELF, MPI_COMM_SELF);
+        plumed->setCollectiveVariables({"c"});
+        plumed->setLogStream(fopen(logPath.c_str(), "w"), true);
+        ASSERT(!plumed->getDeterministic());
+        if (deterministic) {
+            plumed->setDeterministic(true);
+            ASSERT(plumed->getDeterministic());
+        }
+        system.addForce(plumed);
+        VerletIntegrator integ(1e-12);
+        Platform& platform = Platform::getPlatformByName("Reference");
+        {
+            Context context(system, integ, platform);
+            context.setPositions(positions);
+            integ.step(2);
+            context.setPositions(positions);
+            forces.push_back(context.getState(State::Forces).getForces());
+            vector<double> cv;
+            plumed->getCollectiveVariableValues(context, cv);
+            values.push_back(cv[0]);
+        }
+        plumed->setLogStream(stdout);
+        logs.push_back(readLog(logPath));
+        remove(logPath.c_str());
+    }
+    if (oldSetting == NULL)
+        unsetenv("PLUMED_NUM_THREADS");
+    else
+        setenv("PLUMED_NUM_THREADS", oldThreads.c_str(), 1);
+    computeDeterministicForce();
+    for (int run = 0; run < 4; run++)
+        ASSERT(logs[run].find("Number of threads: 4") != string::npos);
+    ASSERT(values[0] > 0);
+    ASSERT_EQUAL_TOL(values[0], values[1], 1e-10);
+    ASSERT(values[1] == values[2]);
+    ASSERT_EQUAL_TOL(values[0], values[3], 1e-10);
+    for (int i = 0; i < numParticles; i++) {
+        ASSERT_EQUAL_VEC(forces[0][i], forces[1][i], 1e-8);
+        ASSERT(forces[1][i] == forces[2][i]);
+    }
+}
+
+static PlumedForce* createStressSystem(int index, System& system, vector<Vec3>& positions) {
+    // Every System restrains a different distance to a different value, so results cannot be mixed up unnoticed.
+
+    for (int i = 0; i < 4; i++) {
+        system.addParticle(1.0+0.1*index);
+        positions.push_back(Vec3(i, 0.1*i*(index+1), -0.3*i));
+    }
+    stringstream script;
+    script << "d: DISTANCE ATOMS=1,3\n" << "RESTRAINT ARG=d AT=" << 0.5+0.1*index << " KAPPA=" << 10+index;
+    PlumedForce* plumed = new PlumedForce(script.str(), MPI_COMM_SELF, MPI_COMM_SELF);
+    plumed->setCollectiveVariables({"d"});
+    system.addForce(plumed);
+    return plumed;
+}
+
+void testConcurrentContexts() {
+    // Step many Contexts in one process from several threads at once, and check that each one ends up bitwise identical to the
+    // same Context stepped on its own.
+
+    const int numContexts = 16, numThreads = 4, numSteps = 50;
+    vector<vector<Vec3> > sequential(numContexts), concurrent(numContexts);
+    vector<double> sequentialValues(numContexts), concurrentValues(numContexts);
+    for (int i = 0; i < numContexts; i++) {
+        System system;
+        vector<Vec3> positions;
+        PlumedForce* plumed = createStressSystem(i, system, positions);
+        VerletIntegrator integ(0.002);
+        Context context(system, integ, Platform::getPlatformByName("Reference"));
+        context.setPositions(positions);
+        integ.step(numSteps);
+        sequential[i] = context.getState(State::Positions).getPositions();
+        vector<double> values;
+        plumed->getCollectiveVariableValues(context, values);
+        sequentialValues[i] = values[0];
+    }
+
+    // Each thread creates its Contexts, steps them in turn one step at a time, and destroys them, so creation,
+    // stepping and destruction all overlap between threads.
+
+    vector<exception_ptr> errors(numThreads);
+    vector<thread> threads;
+    for (int t = 0; t < numThreads; t++)
+        threads.push_back(thread([&, t] () {
+            try {
+                vector<unique_ptr<System> > systems;
+                vector<unique_ptr<VerletIntegrator> > integrators;
+                vector<unique_ptr<Context> > contexts;
+                vector<PlumedForce*> forces;
+                for (int i = t; i < numContexts; i += numThreads) {
+                    vector<Vec3> positions;
+                    systems.push_back(unique_ptr<System>(new System()));
+                    forces.push_back(createStressSystem(i, *systems.back(), positions));
+                    integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.002)));
+                    contexts.push_back(unique_ptr<Context>(new Context(*systems.back(), *integrators.back(), Platform::getPlatformByName("Reference"))));
+                    contexts.back()->setPositions(positions);
+                }
+                for (int step = 0; step < numSteps; step++)
+                    for (auto& integ : integrators)
+                        integ->step(1);
+                for (int k = 0; k < contexts.size(); k++) {
+                    int i = t+k*numThreads;
+                    concurrent[i] = contexts[k]->getState(State::Positions).getPositions();
+                    vector<double> values;
+                    forces[k]->getCollectiveVariableValues(*contexts[k], values);
+                    concurrentValues[i] = values[0];
+                }
+            }
+            catch (...) {
+                errors[t] = current_exception();
+            }
+        }));
+    for (auto& t : threads)
+        t.join();
+    for (auto& error : errors)
+        if (error)
+            rethrow_exception(error);
+    for (int i = 0; i < numContexts; i++) {
+        ASSERT(concurrentValues[i] == sequentialValues[i]);
+        for (int j = 0; j < sequential[i].size(); j++)
+            ASSERT(concurrent[i][j] == sequential[i][j]);
+    }
+}
+
+/**
+ * Compute the same script with PLUMED and with the plugin's own metadynamics along the same path, and check that
+ * the energies, forces and recorded values agree.
+ */
+void compareNativeMetadynamics(const string& script, const vector<string>& labels, double temperature) {
+    vector<unique_ptr<System> > systems;
+    vector<unique_ptr<VerletIntegrator> > integrators;
+    vector<unique_ptr<Context> > contexts;
+    vector<PlumedForce*> forces;
+    for (int i = 0; i < 2; i++) {
+        systems.push_back(unique_ptr<System>(new System()));
+        for (int j = 0; j < 3; j++)
+            systems[i]->addParticle(1.0);
+        PlumedForce* plumed = new PlumedForce(script, MPI_COMM_SELF, MPI_COMM_SELF);
+        plumed->setCollectiveVariables(labels);
+        plumed->setTemperature(temperature);
+        plumed->setUseNativeMetadynamics(i == 1);
+        systems[i]->addForce(plumed);
+        forces.push_back(plumed);
+        integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.002)));
+        contexts.push_back(unique_ptr<Context>(new Context(*systems[i], *integrators[i], Platform::getPlatformByName("Reference"))));
+    }
+    OpenMM_SFMT::SFMT sfmt;
+    init_gen_rand(0, sfmt);
+    vector<Vec3> positions = {Vec3(0, 0, 0), Vec3(0.1, 0.3, 0), Vec3(0.5, 0, 0)};
+    for (int step = 0; step < 60; step++) {
+        for (Vec3& p : positions)
+            p += Vec3(genrand_real2(sfmt)-0.5, genrand_real2(sfmt)-0.5, genrand_real2(sfmt)-0.5)*0.05;
+        vector<State> states;
+        vector<vector<double> > values(2);
+        for (int i = 0; i < 2; i++) {
+            contexts[i]->setStepCount(step);
+            contexts[i]->setPositions(positions);
+            states.push_back(contexts[i]->getState(State::Energy | State::Forces));
+            forces[i]->getCollectiveVariableValues(*contexts[i], values[i]);
+        }
+        ASSERT_EQUAL_TOL(states[0].getPotentialEnergy(), states[1].getPotentialEnergy(), 1e-6);
+        for (int j = 0; j < 3; j++)
+            ASSERT_EQUAL_VEC(states[0].getForces()[j], states[1].getForces()[j], 1e-6);
+        if (step > 0)
+            for (int j = 0; j < labels.size(); j++)
+                ASSERT_EQUAL_TOL(values[0][j], values[1][j], 1e-6);
+    }
+}
+
+void testNativeMetadynamics() {
+    // Plain metadynamics on a component of a position, summing the hills.
+
+    compareNativeMetadynamics("p: POSITION ATOM=1\n"
+                              "METAD ARG=p.x SIGMA=0.05 HEIGHT=0.1 PACE=2 FILE=HILLS.plain", {"p.x"}, 300.0);
+
+    // Well-tempered metadynamics on two variables, accumulating the hills on a grid.
+
+    compareNativeMetadynamics("d: DISTANCE ATOMS=1,3\n"
+                              "p: POSITION ATOM=2 NOPBC\n"
+                              "m: METAD ARG=d,p.y SIGMA=0.05,0.04 HEIGHT=0.5 PACE=1 BIASFACTOR=5 TEMP=300 "
+                              "GRID_MIN=-1,-1 GRID_MAX=2,2 GRID_BIN=300,300 FILE=HILLS.grid", {"d", "m.bias"}, -1.0);
+
+    // Anything else is computed by PLUMED.
+
+    System system;
+    system.addParticle(1.0);
+    PlumedForce* plumed = new PlumedForce("p: POSITION ATOM=1\n"
+                                          "METAD ARG=p.x SIGMA=0.5 HEIGHT=0.1 PACE=1 FILE=HILLS.fallback\n"
+                                          "PRINT ARG=p.x FILE=COLVAR.fallback", MPI_COMM_SELF, MPI_COMM_SELF);
+    plumed->setUseNativeMetadynamics(true);
+    system.addForce(plumed);
+    VerletIntegrator integ(0.002);
+    Context context(system, integ, Platform::getPlatformByName("Reference"));
+    context.setPositions({Vec3()});
+    integ.step(2);
+    ASSERT(ifstream("COLVAR.fallback.0").good());
+}
+
+/**
+ * Compute a script with PLUMED and with the contact variables computed by the plugin, for random positions, and
+ * check that the energies, forces and recorded values agree.
+ */
+void compareDeviceContactVariables(const string& script, const vector<string>& labels, bool periodic) {
+    const int numParticles = 10;
+    vector<unique_ptr<System> > systems;
+    vector<unique_ptr<VerletIntegrator> > integrators;
+    vector<unique_ptr<Context> > contexts;
+    vector<PlumedForce*> forces;
+    for (int i = 0; i < 2; i++) {
+        systems.push_back(unique_ptr<System>(new System()));
+        for (int j = 0; j < numParticles; j++)
+            systems[i]->addParticle(1.0);
+        if (periodic) {
+            systems[i]->setDefaultPeriodicBoxVectors(Vec3(1.2, 0, 0), Vec3(0.3, 1.1, 0), Vec3(-0.2, 0.4, 1.3));
+            NonbondedForce* nonbonded = new NonbondedForce();
+            for (int j = 0; j < numParticles; j++)
+                nonbonded->addParticle(0.0, 0.1, 0.0);
+            nonbonded->setNonbondedMethod(NonbondedForce::CutoffPeriodic);
+            nonbonded->setCutoffDistance(0.5);
+            systems[i]->addForce(nonbonded);
+        }
+        PlumedForce* plumed = new PlumedForce(script, MPI_COMM_SELF, MPI_COMM_SELF);
+        plumed->setCollectiveVariables(labels);
+        plumed->setUseDeviceContactVariables(i == 1);
+        systems[i]->addForce(plumed);
+        forces.push_back(plumed);
+        integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.002)));
+        contexts.push_back(unique_ptr<Context>(new Context(*systems[i], *integrators[i], Platform::getPlatformByName("Reference"))));
+    }
+    OpenMM_SFMT::SFMT sfmt;
+    init_gen_rand(0, sfmt);
+    for (int step = 0; step < 10; step++) {
+        vector<Vec3> positions(numParticles);
+        for (Vec3& p : positions)
+            p = Vec3(genrand_real2(sfmt), genrand_real2(sfmt), genrand_real2(sfmt))*1.5;
+        vector<State> states;
+        vector<vector<double> > values(2);
+        for (int i = 0; i < 2; i++) {
+            contexts[i]->setStepCount(step);
+            contexts[i]->setPositions(positions);
+            states.push_back(contexts[i]->getState(State::Energy | State::Forces));
+            forces[i]->getCollectiveVariableValues(*contexts[i], values[i]);
+        }
+        ASSERT_EQUAL_TOL(states[0].getPotentialEnergy(), states[1].getPotentialEnergy(), 1e-6);
+        for (int j = 0; j < numParticles; j++)
+            ASSERT_EQUAL_VEC(states[0].getForces()[j], states[1].getForces()[j], 1e-6);
+        if (step > 0)
+            for (int j = 0; j < labels.size(); j++)
+                ASSERT_EQUAL_TOL(values[0][j], values[1][j], 1e-6);
+    }
+}
+
+void testDeviceContactVariables() {
+    compareDeviceContactVariables("c: COORDINATION GROUPA=1-5 GROUPB=4-9 R_0=0.3 NN=6 MM=10\n"
+                                  "RESTRAINT ARG=c AT=1.0 KAPPA=10", {"c"}, false);
+    compareDeviceContactVariables("c: COORDINATION GROUPA=1-8 SWITCH={RATIONAL R_0=0.4 D_MAX=1.0}\n"
+                                  "cm: CONTACTMAP ATOMS1=1,2 ATOMS2=3,10 WEIGHT1=1.0 WEIGHT2=0.5 SWITCH={RATIONAL R_0=0.3 NN=8 MM=12} SUM\n"
+                                  "d: DISTANCE ATOMS=1,3\n"
+                                  "RESTRAINT ARG=c,cm,d AT=1.0,0.5,0.4 KAPPA=10,20,5", {"c", "cm"}, true);
+
+    // A COORDINATION with a neighbor list is computed by PLUMED.
+
+    compareDeviceContactVariables("c: COORDINATION GROUPA=1-5 R_0=0.3 NLIST NL_CUTOFF=2.0 NL_STRIDE=1\n"
+                                  "RESTRAINT ARG=c AT=1.0 KAPPA=10", {"c"}, false);
+}
+
+/**
+ * Create a CustomIntegrator with the same program as OpenMM's MTSIntegrator, which evaluates force group 1 once per
+ * step and force group 0 in a number of substeps.
+ */
+CustomIntegrator* createMTSIntegrator(double dt, int substeps) {
+    CustomIntegrator* integrator = new CustomIntegrator(dt);
+    integrator->addPerDofVariable("x1", 0);
+    integrator->addUpdateContextState();
+    integrator->addComputePerDof("v", "v+0.5*dt*f1/m");
+    for (int i = 0; i < substeps; i++) {
+        string step = "(dt/"+to_string(substeps)+")";
+        integrator->addComputePerDof("v", "v+0.5*"+step+"*f0/m");
+        integrator->addComputePerDof("x1", "x");
+        integrator->addComputePerDof("x", "x+"+step+"*v");
+        integrator->addConstrainPositions();
+        integrator->addComputePerDof("v", "(x-x1)/"+step);
+        integrator->addComputePerDof("v", "v+0.5*"+step+"*f0/m");
+    }
+    integrator->addComputePerDof("v", "v+0.5*dt*f1/m");
+    return integrator;
+}
+
+/**
+ * Create a System whose fast force group 0 holds bonds and whose slow force group 1 holds the given force.
+ */
+void createMTSSystem(System& system, vector<Vec3>& positions, Force* slowForce) {
+    const int numParticles = 4;
+    HarmonicBondForce* bonds = new HarmonicBondForce();
+    for (int i = 0; i < numParticles; i++) {
+        system.addParticle(1.0+i);
+        positions.push_back(Vec3(0.3*i, 0.1*(i%2), -0.05*i));
+        if (i > 0)
+            bonds->addBond(i-1, i, 0.3, 5000.0);
+    }
+    system.addForce(bonds);
+    slowForce->setForceGroup(1);
+    system.addForce(slowForce);
+}
+
+void testMultipleTimeStep() {
+    // PLUMED is in the slow force group, which the integrator computes once per step, after moving the particles.
+
+    const int numSteps = 40;
+    const double dt = 0.002;
+    System system;
+    vector<Vec3> positions;
+    PlumedForce* plumed = new PlumedForce("d: DISTANCE ATOMS=1,3\n"
+                                          "METAD ARG=d SIGMA=0.05 HEIGHT=0.1 PACE=2 FILE=HILLS.mts", MPI_COMM_SELF, MPI_COMM_SELF);
+    plumed->setCollectiveVariables({"d"});
+    createMTSSystem(system, positions, plumed);
+    unique_ptr<CustomIntegrator> integrator(createMTSIntegrator(dt, 4));
+    unique_ptr<Context> context(new Context(system, *integrator, Platform::getPlatformByName("Reference")));
+    context->setPositions(positions);
+    context->setVelocitiesToTemperature(300.0, 1);
+
+    // The update for each step must see the positions of that step, even when a computation of another force group
+    // forces the integrator to recompute PLUMED at the start of the next step.
+
+    vector<double> distances(numSteps+1);
+    shared_ptr<PlumedValueStorage> storage = plumed->getValueStorage(*context);
+    for (int i = 1; i <= numSteps; i++) {
+        integrator->step(1);
+        State state = context->getState(State::Positions);
+        Vec3 delta = state.getPositions()[0]-state.getPositions()[2];
+        distances[i] = sqrt(delta.dot(delta));
+        vector<double> values;
+        plumed->getCollectiveVariableValues(*context, values);
+        ASSERT_EQUAL_TOL(distances[i], values[0], 1e-6);
+        if (i%3 == 0)
+            context->getState(State::Energy, false, 1<<0);
+    }
+
+    // PLUMED was computed once per step, plus at the start of the first step and of every step after getState().
+    // Only the computations at the ends of steps update it, which adds one hill every other step.
+
+    ASSERT_EQUAL(numSteps+numSteps/3+1, storage->getCounters()[PlumedValueStorage::NumCalculations]);
+    context.reset();
+    ifstream hills("HILLS.0.mts");
+    string line;
+    int numHills = 0;
+    while (getline(hills, line)) {
+        if (line[0] == '#')
+            continue;
+        double time, d;
+        stringstream(line) >> time >> d;
+        int step = (int) round(time/dt);
+        ASSERT_EQUAL(0, step%2);
+        ASSERT_EQUAL_TOL(distances[step], d, 1e-6);
+        numHills++;
+    }
+    ASSERT_EQUAL(numSteps/2, numHills);
+
+    // The integrator applies the forces of the slow group with the outer step, so a trajectory with PLUMED must match
+    // one with the same force as a CustomBondForce.
+
+    vector<State> states;
+    for (int i = 0; i < 2; i++) {
+        System system;
+        vector<Vec3> positions;
+        Force* restraint;
+        if (i == 0)
+            restraint = new PlumedForce("d: DISTANCE ATOMS=1,3\n"
+                                        "RESTRAINT ARG=d AT=0.5 KAPPA=200", MPI_COMM_SELF, MPI_COMM_SELF);
+        else {
+            CustomBondForce* bond = new CustomBondForce("100*(r-0.5)^2");
+            bond->addBond(0, 2);
+            restraint = bond;
+        }
+        createMTSSystem(system, positions, restraint);
+        unique_ptr<CustomIntegrator> integrator(createMTSIntegrator(dt, 4));
+        Context context(system, *integrator, Platform::getPlatformByName("Reference"));
+        context.setPositions(positions);
+        integrator->step(50);
+        states.push_back(context.getState(State::Positions | State::Velocities));
+    }
+    for (int i = 0; i < system.getNumParticles(); i++) {
+        ASSERT_EQUAL_VEC(states[1].getPositions()[i], states[0].getPositions()[i], 1e-6);
+        ASSERT_EQUAL_VEC(states[1].getVelocities()[i], states[0].getVelocities()[i], 1e-6);
+    }
+}
+
+void testReuseTolerance() {
+    // Create two Contexts that restrain the distance between two atoms, one of which reuses the bias and forces while
+    // the atoms move less than the tolerance.
+
+    const int numParticles = 10;
+    const double tolerance = 0.01, kappa = 100.0, at = 0.5;
+    vector<unique_ptr<System> > systems;
+    vector<unique_ptr<VerletIntegrator> > integrators;
+    vector<unique_ptr<Context> > contexts;
+    vector<PlumedForce*> forces;
+    for (int i = 0; i < 2; i++) {
+        systems.push_back(unique_ptr<System>(new System()));
+        for (int j = 0; j < numParticles; j++)
+            systems[i]->addParticle(1.0);
+        PlumedForce* plumed = new PlumedForce("d: DISTANCE ATOMS=1,3\n"
+                                              "RESTRAINT ARG=d AT=0.5 KAPPA=100", MPI_COMM_SELF, MPI_COMM_SELF);
+        if (i == 1)
+            plumed->setReuseTolerance(tolerance);
+        systems[i]->addForce(plumed);
+        forces.push_back(plumed);
+        integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.002)));
+        contexts.push_back(unique_ptr<Context>(new Context(*systems[i], *integrators[i], Platform::getPlatformByName("Reference"))));
+    }
+    ASSERT_EQUAL(tolerance, forces[1]->getReuseTolerance());
+    OpenMM_SFMT::SFMT sfmt;
+    init_gen_rand(0, sfmt);
+    vector<Vec3> initialPositions(numParticles);
+    for (Vec3& p : initialPositions)
+        p = Vec3(genrand_real2(sfmt), genrand_real2(sfmt), genrand_real2(sfmt));
+
+    // Move the atoms by up to the tolerance.  The error of the reused results must stay within the bound given by
+    // the change of the restraint: the distance changes by at most 2*tolerance, and its direction by at most
+    // 4*tolerance/d.  The atoms PLUMED does not use may move anywhere.
+
+    // PLUMED asks for the positions of all atoms the first time, so the reference for the trials is the second
+    // computation.
+
+    shared_ptr<PlumedValueStorage> storage = forces[1]->getValueStorage(*contexts[1]);
+    const int numTrials = 20;
+    for (int trial = -1; trial <= numTrials; trial++) {
+        vector<Vec3> positions = initialPositions;
+        if (trial > 0)
+            for (int j = 0; j < numParticles; j++) {
+                Vec3 delta = Vec3(genrand_real2(sfmt)-0.5, genrand_real2(sfmt)-0.5, genrand_real2(sfmt)-0.5);
+                positions[j] += delta*(j == 0 || j == 2 ? 0.999*tolerance/sqrt(delta.dot(delta)) : 1.0);
+            }
+        vector<State> states;
+        for (int i = 0; i < 2; i++) {
+            contexts[i]->setPositions(positions);
+            states.push_back(contexts[i]->getState(State::Energy | State::Forces));
+        }
+        Vec3 delta = positions[0]-positions[2];
+        double d = sqrt(delta.dot(delta));
+        double energyBound = kappa*fabs(d-at)*2*tolerance + 0.5*kappa*(2*tolerance)*(2*tolerance);
+        double forceBound = kappa*2*tolerance + kappa*fabs(d-at)*4*tolerance/(d-2*tolerance);
+        ASSERT(fabs(states[0].getPotentialEnergy()-states[1].getPotentialEnergy()) <= energyBound*(1+1e-6));
+        for (int j = 0; j < numParticles; j++) {
+            Vec3 error = states[0].getForces()[j]-states[1].getForces()[j];
+            ASSERT(sqrt(error.dot(error)) <= forceBound*(1+1e-6));
+        }
+    }
+    ASSERT_EQUAL(2, storage->getCounters()[PlumedValueStorage::NumCalculations]);
+    ASSERT_EQUAL(numTrials, storage->getCounters()[PlumedValueStorage::ReusedCalculations]);
+
+    // Moving a used atom farther than the tolerance makes PLUMED compute the bias again.
+
+    vector<Vec3> positions = initialPositions;
+    positions[2] += Vec3(2*tolerance, 0, 0);
+    contexts[1]->setPositions(positions);
+    contexts[0]->setPositions(positions);
+    ASSERT_EQUAL_TOL(contexts[0]->getState(State::Energy).getPotentialEnergy(), contexts[1]->getState(State::Energy).getPotentialEnergy(), 1e-10);
+    ASSERT_EQUAL(3, storage->getCounters()[PlumedValueStorage::NumCalculations]);
+
+    // PLUMED is still updated at every step while the results are reused, so a value is printed for each step after
+    // the first.
+
+    PlumedForce* plumed = new PlumedForce("d: DISTANCE ATOMS=1,2\n"
+                                          "RESTRAINT ARG=d AT=0.5 KAPPA=100\n"
+                                          "PRINT ARG=d FILE=COLVAR.reuse", MPI_COMM_SELF, MPI_COMM_SELF);
+    plumed->setReuseTolerance(tolerance);
+    System system;
+    system.addParticle(1000.0);
+    system.addParticle(1000.0);
+    system.addForce(plumed);
+    VerletIntegrator integ(0.001);
+    unique_ptr<Context> context(new Context(system, integ, Platform::getPlatformByName("Reference")));
+    context->setPositions({Vec3(), Vec3(0.6, 0, 0)});
+    integ.step(20);
+    storage = plumed->getValueStorage(*context);
+    ASSERT(storage->getCounters()[PlumedValueStorage::ReusedCalculations] > 0);
+    context.reset();
+    ifstream colvar("COLVAR.reuse.0");
+    string line;
+    int numLines = 0;
+    while (getline(colvar, line))
+        if (line[0] != '#')
+            numLines++;
+    ASSERT_EQUAL(19, numLines);
+}
+
+void testReuseTimeDependentBias() {
+    // Only scripts made of static actions may reuse results across steps.
+
+    ASSERT(PlumedReuseCheck::isStatic("d: DISTANCE ATOMS=1,2\nRESTRAINT ARG=d AT=0.5 KAPPA=100 # a comment\nPRINT ARG=d FILE=COLVAR"));
+    ASSERT(PlumedReuseCheck::isStatic("d: DISTANCE ATOMS=1,2\nUPPER_WALLS ...\n  ARG=d AT=1 KAPPA=10\n... UPPER_WALLS\nENDPLUMED\nMETAD"));
+    ASSERT(!PlumedReuseCheck::isStatic("d: DISTANCE ATOMS=1,2\nMETAD ARG=d SIGMA=0.1 HEIGHT=1 PACE=1"));
+    ASSERT(!PlumedReuseCheck::isStatic("d: DISTANCE ATOMS=1,2\nINCLUDE FILE=bias.dat"));
+
+    // A METAD adds a hill at every update, and a MOVINGRESTRAINT moves at every step.  Step a Context that reuses
+    // results alongside one that does not, and check that their energies match at every step.  Results may still be
+    // reused within a step.
+
+    const double tolerance = 0.01;
+    const int numSteps = 10;
+    const vector<string> scripts = {"d: DISTANCE ATOMS=1,2\n"
+                                    "METAD ARG=d SIGMA=0.1 HEIGHT=1 PACE=1 FILE=HILLS.reuse",
+                                    "d: DISTANCE ATOMS=1,2\n"
+                                    "MOVINGRESTRAINT ARG=d STEP0=0 AT0=0.5 KAPPA0=100 STEP1=10 AT1=0.7 LABEL=m"};
+    for (const string& script : scripts) {
+        vector<unique_ptr<System> > systems;
+        vector<unique_ptr<VerletIntegrator> > integrators;
+        vector<unique_ptr<Context> > contexts;
+        vector<PlumedForce*> forces;
+        for (int i = 0; i < 2; i++) {
+            systems.push_back(unique_ptr<System>(new System()));
+            systems[i]->addParticle(1000.0);
+            systems[i]->addParticle(1000.0);
+            PlumedForce* plumed = new PlumedForce(script+to_string(i), MPI_COMM_SELF, MPI_COMM_SELF);
+            if (i == 1)
+                plumed->setReuseTolerance(tolerance);
+            systems[i]->addForce(plumed);
+            forces.push_back(plumed);
+            integrators.push_back(unique_ptr<VerletIntegrator>(new VerletIntegrator(0.001)));
+            contexts.push_back(unique_ptr<Context>(new Context(*systems[i], *integrators[i], Platform::getPlatformByName("Reference"))));
+            contexts[i]->setPositions({Vec3(), Vec3(0.6, 0, 0)});
+        }
+        vector<double> energies[2];
+        for (int i = 0; i < 2; i++)
+            for (int step = 0; step < numSteps; step++) {
+                integrators[i]->step(1);
+                for (int j = 0; j < 2; j++)
+                    energies[i].push_back(contexts[i]->getState(State::Energy).getPotentialEnergy());
+            }
+        for (int j = 0; j < energies[0].size(); j++)
+            ASSERT_EQUAL_TOL(energies[0][j], energies[1][j], 1e-6);
+        ASSERT(energies[0].back() != energies[0][0]);
+        ASSERT(forces[1]->getValueStorage(*contexts[1])->getCounters()[PlumedValueStorage::ReusedCalculations] > 0);
+    }
+    remove("HILLS.reuse0.0");
+    remove("HILLS.reuse1.0");
+}
+
 int main() {
     try {
         registerPlumedReferenceKernelFactories();
@@ -285,6 +1328,21 @@ int main() {
         testWellTemperedMetadynamics();
         testMassesCharges();
         testScript();
+        testCollectiveVariables();
+        testAsyncStepper();
+        testCalvadosSystemBuilder();
+        testExclusionFile();
+        testMassRepartitioning();
+        testTrace();
+        testLoadBalanceReport();
+        testHardwareCounters();
+        testDeterministic();
+        testConcurrentContexts();
+        testNativeMetadynamics();
+        testDeviceContactVariables();
+        testMultipleTimeStep();
+        testReuseTolerance();
+        testReuseTimeDependentBias();
     }
     catch(const std::exception& e) {
         std::cout << "exception: " << e.what() << std::endl;
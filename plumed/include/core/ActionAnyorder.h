@@ -0,0 +1,48 @@
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+   Copyright (c) 2011-2022 The plumed team
+   (see the PEOPLE file at the root of the distribution for a list of names)
+
+   See http://www.plumed.org for more information.
+
+   This file is part of plumed, version 2.
+
+   plumed is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   plumed is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with plumed.  If not, see <http://www.gnu.org/licenses/>.
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+#ifndef __PLUMED_core_ActionAnyorder_h
+#define __PLUMED_core_ActionAnyorder_h
+
+#include "Action.h"
+
+namespace PLMD {
+
+/**
+\ingroup MULTIINHERIT
+Action used to create a PLMD::Action that can go both before and after ActionSetup actions.
+*/
+class ActionAnyorder :
+  public virtual Action {
+public:
+/// Constructor
+  explicit ActionAnyorder(const ActionOptions&ao);
+/// Creator of keywords
+  static void registerKeywords( Keywords& keys );
+/// Do nothing.
+  void calculate() override {}
+/// Do nothing.
+  void apply() override {}
+};
+
+}
+
+#endif
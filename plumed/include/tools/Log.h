@@ -0,0 +1,42 @@
+/* +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+   Copyright (c) 2011-2022 The plumed team
+   (see the PEOPLE file at the root of the distribution for a list of names)
+
+   See http://www.plumed.org for more information.
+
+   This file is part of plumed, version 2.
+
+   plumed is free software: you can redistribute it and/or modify
+   it under the terms of the GNU Lesser General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   plumed is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU Lesser General Public License for more details.
+
+   You should have received a copy of the GNU Lesser General Public License
+   along with plumed.  If not, see <http://www.gnu.org/licenses/>.
++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++ */
+#ifndef __PLUMED_tools_Log_h
+#define __PLUMED_tools_Log_h
+
+#include "OFile.h"
+
+namespace PLMD {
+
+/// Class containing the log stream.
+///
+/// It is similar to a FILE stream. It allows a printf() function, and
+/// also to write with a << operator. Moreover, it can prefix
+/// lines with the "PLUMED:" prefix, useful to grep out plumed
+/// log from output
+class Log :
+  public OFile
+{
+};
+
+}
+
+#endif
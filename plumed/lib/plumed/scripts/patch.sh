@@ -0,0 +1,4 @@
+#! /usr/bin/env bash
+
+"${PLUMED_ROOT}"/patches/patch.sh "$@"
+
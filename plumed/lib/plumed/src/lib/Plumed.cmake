@@ -0,0 +1,8 @@
+set(PLUMED_RUNTIME_LOAD  "/home/hussein/opt/lib/libplumedWrapper.a" -ldl  )
+set(PLUMED_STATIC_LOAD  "/home/hussein/opt/lib/libplumed.a" -ldl  -lstdc++ -lz -ldl   -rdynamic -Wl,-Bsymbolic -fopenmp )
+set(PLUMED_SHARED_LOAD  "/home/hussein/opt/lib/libplumed.so" -ldl  )
+set(PLUMED_RUNTIME_DEPENDENCIES )
+set(PLUMED_STATIC_DEPENDENCIES  "/home/hussein/opt/lib/libplumed.a")
+set(PLUMED_SHARED_DEPENDENCIES  "/home/hussein/opt/lib/libplumed.so")
+set(PLUMED_FORTRAN  "/home/hussein/opt/lib/plumed/fortran/plumed.f90")
+set(PLUMED_FORTRAN08  "/home/hussein/opt/lib/plumed/fortran/plumed_f08.f90")
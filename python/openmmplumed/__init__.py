@@ -0,0 +1,10 @@
+"""
+OpenMM plugin that applies biases computed by PLUMED.
+
+PlumedForce is the SWIG wrapper of the C++ class, CalvadosSystemBuilder builds CALVADOS coarse-grained Systems and
+ExclusionFile applies binary exclusion lists.  The views module gives zero-copy access to the values PlumedForce
+records, and the ensemble module drives a set of replicas, one per MPI rank.
+"""
+
+from .openmmplumed import PlumedForce, CalvadosSystemBuilder, ExclusionFile
+from . import views
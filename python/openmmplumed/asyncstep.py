@@ -0,0 +1,86 @@
+"""
+Advance a Context on a C++ thread while Python keeps working.
+
+    stepper = AsyncStepper(context, force, stride=10)
+    future = stepper.step_async(5000)
+    ...                                  # analyze the previous chunk here
+    steps, bias, values = future.result()
+
+Every `stride` steps the bias and the values recorded by the PlumedForce (see setCollectiveVariables()) are copied
+into a ring buffer of `capacity` snapshots.  snapshots() drains it at any time, and the future of a run resolves to
+the snapshots that had not been read when the run finished.  Snapshots that are overwritten before being read are
+counted by getNumDropped().
+
+While a run is in progress the Context and its Integrator must not be used from Python.
+"""
+
+import concurrent.futures
+import threading
+
+import numpy as np
+
+from .openmmplumed import PlumedAsyncStepper
+
+
+class AsyncStepper(object):
+    """Runs steps of a Context asynchronously and collects PLUMED snapshots at a fixed stride."""
+
+    def __init__(self, context, force, stride=10, capacity=1024):
+        """
+        Parameters
+        ----------
+        context : Context
+            the Context to advance.  It must contain force.
+        force : PlumedForce
+            the force whose bias and recorded values are captured
+        stride : int
+            the number of steps between snapshots
+        capacity : int
+            the number of snapshots the ring buffer holds
+        """
+        # Keep the Context and the force alive for as long as the C++ object refers to them.
+        self._context = context
+        self._force = force
+        self._stepper = PlumedAsyncStepper(context, force, stride, capacity)
+        self._waiter = None
+
+    def step_async(self, steps):
+        """
+        Start taking steps on a C++ thread and return a concurrent.futures.Future.  Its result is the tuple
+        (steps, bias, values) returned by snapshots() once the run is complete; if the run fails, the future holds
+        the exception.  A new run can only start after the previous one has finished.
+        """
+        if self._waiter is not None and self._waiter is not threading.current_thread():
+            self._waiter.join()
+        self._stepper.start(steps)
+        future = concurrent.futures.Future()
+        future.set_running_or_notify_cancel()
+        self._waiter = threading.Thread(target=self._finish, args=(future,), daemon=True)
+        self._waiter.start()
+        return future
+
+    def _finish(self, future):
+        # wait() releases the GIL while the C++ thread runs.
+        try:
+            self._stepper.wait()
+        except Exception as ex:
+            future.set_exception(ex)
+        else:
+            future.set_result(self.snapshots())
+
+    def running(self):
+        """Get whether a run is in progress."""
+        return self._stepper.isRunning()
+
+    def snapshots(self):
+        """
+        Remove the snapshots from the ring buffer and return them, oldest first, as a tuple of numpy arrays
+        (steps, bias, values) with shapes (n,), (n,) and (n, number of recorded values).
+        """
+        size = self._stepper.getSnapshotSize()
+        data = np.frombuffer(self._stepper.readSnapshots(), dtype=np.float64).reshape(-1, size)
+        return data[:, 0].astype(np.int64), data[:, 1], data[:, 2:]
+
+    def getNumDropped(self):
+        """Get the number of snapshots that were overwritten before being read."""
+        return self._stepper.getNumDropped()
@@ -0,0 +1,179 @@
+"""
+Run an ensemble of replicas biased by PLUMED, one replica per MPI rank.
+
+Every rank builds its replica from the same System plus its own entry in a list of overrides, so a whole ensemble
+is set up with a single call:
+
+    ensemble = ReplicaEnsemble(system, integrator, script, positions,
+                               overrides=[{'temperature': 300.0}, {'temperature': 320.0}],
+                               collectiveVariables=['d'])
+    ensemble.run(100000, 1000)
+
+run() advances the simulation in chunks that execute entirely in C++.  After every chunk the potential energy,
+the PLUMED bias and the recorded collective variables of all replicas are gathered to rank 0 with one MPI call and
+stored in numpy arrays, instead of each replica writing its own output files.
+"""
+
+from mpi4py import MPI
+import numpy as np
+import simtk.openmm as mm
+import simtk.unit as unit
+
+from .openmmplumed import PlumedForce
+
+
+def _strip(value, units):
+    if unit.is_quantity(value):
+        return value.value_in_unit(units)
+    return value
+
+
+class ReplicaEnsemble(object):
+    """
+    A set of replicas that share a System and a PLUMED script, each running on its own MPI rank.
+
+    The communicators passed to PLUMED are created here: every replica gets a single rank intra-replica
+    communicator, and the inter-replica communicator spans all ranks of comm, so that PLUMED multiple walkers and
+    GREX work across the ensemble.
+
+    Each entry of overrides is a dict that may contain:
+
+      script       the PLUMED script for this replica (replaces the shared one)
+      temperature  the temperature in Kelvin, set on the PlumedForce and on the integrator if it has one
+      positions    the initial positions of this replica
+      velocities   the initial velocities of this replica
+      masses       the masses PLUMED sees for this replica (see PlumedForce.setMasses())
+      parameters   a dict of Context global parameter values
+      seed         the random number seed of the integrator, if it has one
+    """
+
+    def __init__(self, system, integrator, script, positions, overrides=None, collectiveVariables=(), comm=None,
+                 platform=None, properties=None, restart=False):
+        """
+        Create the replica owned by this rank.  This is a collective call over comm.
+
+        Parameters
+        ----------
+        system : System
+            the System shared by all replicas.  It is copied, so the PlumedForce is not added to it.
+        integrator : Integrator
+            the integrator shared by all replicas.  It is copied for the replica.
+        script : str
+            the PLUMED script, unless a replica overrides it
+        positions : list
+            the initial positions, unless a replica overrides them
+        overrides : list of dict
+            one dict per replica (i.e. per rank of comm) with the settings that differ from the shared ones
+        collectiveVariables : list of str
+            the labels of the PLUMED values to record after every chunk (e.g. "d" or "p.x")
+        comm : mpi4py.MPI.Comm
+            the communicator spanning the ensemble.  Defaults to MPI.COMM_WORLD.
+        platform : Platform
+            the Platform to simulate the replica on
+        properties : dict
+            the Platform properties
+        restart : bool
+            whether PLUMED should restart from the files of a previous run
+        """
+        if comm is None:
+            comm = MPI.COMM_WORLD
+        self.comm = comm
+        self.replica = comm.Get_rank()
+        self.numReplicas = comm.Get_size()
+        if overrides is None:
+            overrides = [{}]*self.numReplicas
+        if len(overrides) != self.numReplicas:
+            raise ValueError('Got %d overrides for an ensemble of %d replicas' % (len(overrides), self.numReplicas))
+        options = overrides[self.replica]
+        unknown = set(options) - {'script', 'temperature', 'positions', 'velocities', 'masses', 'parameters', 'seed'}
+        if unknown:
+            raise ValueError('Unknown replica overrides: %s' % ', '.join(sorted(unknown)))
+
+        # Every replica is driven by a single rank, and all of them talk to each other through the inter-replica
+        # communicator.
+
+        self.intraComm = comm.Split(self.replica, 0)
+        self.interComm = comm.Dup()
+
+        self.system = mm.XmlSerializer.clone(system)
+        self.integrator = mm.XmlSerializer.clone(integrator)
+        self.force = PlumedForce(options.get('script', script), self.intraComm, self.interComm)
+        self.force.setRestart(restart)
+        self.force.setCollectiveVariables(list(collectiveVariables))
+        if 'temperature' in options:
+            temperature = _strip(options['temperature'], unit.kelvin)
+            self.force.setTemperature(temperature)
+            if hasattr(self.integrator, 'setTemperature'):
+                self.integrator.setTemperature(temperature)
+        if 'masses' in options:
+            self.force.setMasses(np.ascontiguousarray(_strip(options['masses'], unit.dalton), dtype=np.float64))
+        if 'seed' in options and hasattr(self.integrator, 'setRandomNumberSeed'):
+            self.integrator.setRandomNumberSeed(options['seed'])
+        self.system.addForce(self.force)
+
+        if platform is None:
+            self.context = mm.Context(self.system, self.integrator)
+        elif properties is None:
+            self.context = mm.Context(self.system, self.integrator, platform)
+        else:
+            self.context = mm.Context(self.system, self.integrator, platform, properties)
+        for name, value in options.get('parameters', {}).items():
+            self.context.setParameter(name, value)
+        self.context.setPositions(options.get('positions', positions))
+        if 'velocities' in options:
+            self.context.setVelocities(options['velocities'])
+
+        self.collectiveVariables = tuple(collectiveVariables)
+        self.stepsTaken = 0
+        self.steps = None
+        self.potentialEnergies = None
+        self.biasEnergies = None
+        self.collectiveVariableValues = None
+
+    def run(self, steps, chunkSize):
+        """
+        Advance every replica by a number of steps.  This is a collective call over the ensemble communicator.
+
+        The steps are taken in chunks of chunkSize.  After each chunk the potential energy and bias (in kJ/mol) and
+        the recorded collective variables of every replica are gathered on rank 0, where they are stored in
+        steps (shape (chunks,)), potentialEnergies and biasEnergies (shape (chunks, replicas)) and
+        collectiveVariableValues (shape (chunks, replicas, collective variables)), replacing the results of any
+        earlier call.  On the other ranks these attributes are None.
+        """
+        if chunkSize <= 0:
+            raise ValueError('The chunk size must be positive')
+        numChunks = (steps+chunkSize-1)//chunkSize
+        numColumns = 2+len(self.collectiveVariables)
+        row = np.empty(numColumns, dtype=np.float64)
+        root = (self.replica == 0)
+        table = (np.empty((numChunks, self.numReplicas, numColumns), dtype=np.float64) if root else None)
+        stepIndex = np.empty(numChunks, dtype=np.int64)
+        done = 0
+        for chunk in range(numChunks):
+            count = min(chunkSize, steps-done)
+            self.integrator.step(count)
+            done += count
+
+            # Computing the energy makes PLUMED process the new step, which also records the collective variables.
+
+            state = self.context.getState(getEnergy=True)
+            row[0] = state.getPotentialEnergy().value_in_unit(unit.kilojoules_per_mole)
+            row[1] = self.force.getBiasEnergy(self.context)
+            row[2:] = self.force.getCollectiveVariableValues(self.context)
+            stepIndex[chunk] = self.stepsTaken+done
+            self.comm.Gather(row, table[chunk] if root else None, root=0)
+
+        self.stepsTaken += done
+        if root:
+            self.steps = stepIndex
+            self.potentialEnergies = table[:, :, 0]
+            self.biasEnergies = table[:, :, 1]
+            self.collectiveVariableValues = table[:, :, 2:]
+        else:
+            self.steps = self.potentialEnergies = self.biasEnergies = self.collectiveVariableValues = None
+
+    def close(self):
+        """Release the Context and the communicators created for this replica."""
+        del self.context
+        self.intraComm.Free()
+        self.interComm.Free()
@@ -0,0 +1,37 @@
+"""
+Zero-copy access to the values a PlumedForce records in a Context.
+
+PlumedForce.getValueViews(context) returns a ValueViews tuple of read-only float64 memoryviews backed directly by
+the plugin's storage:
+
+  bias      one element, the bias energy (kJ/mol) from the most recent force computation
+  counters  the timing counters, indexed by NumCalculations, CalculationTime, TransferTime and
+            ReplicaWaitTime (seconds), and the hardware event counts of the calculation and transfer phases,
+            indexed by CalculationCycles, CalculationInstructions, CalculationCacheMisses, TransferCycles,
+            TransferInstructions and TransferCacheMisses (see PlumedForce.setUseHardwareCounters()), and
+            ReusedCalculations, the number of computations that reused the previous bias (see
+            PlumedForce.setReuseTolerance())
+  values    the PLUMED values selected with setCollectiveVariables(), in the same order
+
+Reading them involves no SWIG call, so they are suitable for high frequency polling, e.g. every few steps in an
+adaptive sampling loop.  numpy.asarray() wraps them without copying.  The views remain valid after the Context is
+deleted, but then stop changing.
+"""
+
+import collections
+
+from . import _views
+
+NumCalculations = _views.NumCalculations
+CalculationTime = _views.CalculationTime
+TransferTime = _views.TransferTime
+ReplicaWaitTime = _views.ReplicaWaitTime
+CalculationCycles = _views.CalculationCycles
+CalculationInstructions = _views.CalculationInstructions
+CalculationCacheMisses = _views.CalculationCacheMisses
+TransferCycles = _views.TransferCycles
+TransferInstructions = _views.TransferInstructions
+TransferCacheMisses = _views.TransferCacheMisses
+ReusedCalculations = _views.ReusedCalculations
+
+ValueViews = collections.namedtuple('ValueViews', ['bias', 'counters', 'values'])
@@ -0,0 +1,24 @@
+/*
+ * The part of the OpenMM API that the openmmplumed interface refers to.  plumedplugin.i imports this file instead
+ * of swig/OpenMMSwigHeaders.i, so SWIG parses a handful of declarations rather than the whole OpenMM API (including
+ * the Amoeba, Drude and RPMD plugins), and the wrapper only includes the headers it needs.  The classes themselves
+ * are wrapped by simtk.openmm; their proxies are found at run time through the shared SWIG type table.
+ */
+
+namespace OpenMM {
+
+class Force {
+public:
+    virtual ~Force();
+};
+
+class CustomNonbondedForce : public Force {
+};
+
+class Context {
+};
+
+class System {
+};
+
+}
@@ -1,32 +1,334 @@
-%module openmmplumed
+%module(package="openmmplumed") openmmplumed
 
 
-%import(module="simtk.openmm") "swig/OpenMMSwigHeaders.i"
+%import(module="simtk.openmm") "openmmtypes.i"
 %include "swig/typemaps.i"
 %include "std_string.i"
 %include "mpi4py.i"
 %mpi4py_typemap(Comm, MPI_Comm);
 
 %{
+#include "CalvadosSystemBuilder.h"
+#include "ExclusionFile.h"
+#include "PlumedAsyncStepper.h"
 #include "PlumedForce.h"
-#include "OpenMM.h"
-#include "OpenMMAmoeba.h"
-#include "OpenMMDrude.h"
-#include "openmm/RPMDIntegrator.h"
-#include "openmm/RPMDMonteCarloBarostat.h"
+#include "openmm/Context.h"
+#include "openmm/CustomNonbondedForce.h"
+#include "openmm/System.h"
+#include "openmm/Vec3.h"
 #include <mpi.h>
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+
+static void deleteValueStorageCapsule(PyObject* capsule) {
+    delete (std::shared_ptr<PlumedPlugin::PlumedValueStorage>*) PyCapsule_GetPointer(capsule, "openmmplumed.PlumedValueStorage");
+}
+
+static void deleteMassesCapsule(PyObject* capsule) {
+    delete (std::shared_ptr<const std::vector<double> >*) PyCapsule_GetPointer(capsule, "openmmplumed.Masses");
+}
 %}
 
 %pythoncode %{
 import simtk.openmm as mm
 %}
 
+/* C++ exceptions, e.g. OpenMMException, are raised as Python exceptions. */
+%exception {
+    try {
+        $action
+    }
+    catch (std::exception& ex) {
+        PyErr_SetString(PyExc_Exception, ex.what());
+        SWIG_fail;
+    }
+}
+
+/*
+ * The module is generated with -threads, so the GIL is released while each wrapped call runs in C++.  The
+ * typemaps below touch Python objects and therefore run before the GIL is released or after it is reacquired.
+ */
+
+/*
+ * The masses are read through the buffer protocol, so a C-contiguous float64 array (e.g. from numpy) is
+ * copied into the vector with a single memcpy.  Anything else is converted element by element.
+ */
+%typemap(in, fragment="Py_StripOpenMMUnits") const std::vector<double>& masses (std::vector<double> v) {
+    PyObject* stripped = Py_StripOpenMMUnits($input);
+    if (stripped == NULL)
+        SWIG_fail;
+    Py_buffer view;
+    bool copied = false;
+    if (PyObject_CheckBuffer(stripped) && PyObject_GetBuffer(stripped, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0) {
+        if (view.ndim == 1 && view.itemsize == sizeof(double) && view.format != NULL && strcmp(view.format, "d") == 0) {
+            const double* data = (const double*) view.buf;
+            v.assign(data, data+view.len/sizeof(double));
+            copied = true;
+        }
+        PyBuffer_Release(&view);
+    }
+    PyErr_Clear();
+    if (!copied) {
+        PyObject* sequence = PySequence_Fast(stripped, "in method $symname, the masses must be a sequence of numbers");
+        if (sequence == NULL) {
+            Py_DECREF(stripped);
+            SWIG_fail;
+        }
+        Py_ssize_t length = PySequence_Fast_GET_SIZE(sequence);
+        PyObject** items = PySequence_Fast_ITEMS(sequence);
+        v.resize(length);
+        for (Py_ssize_t i = 0; i < length; i++)
+            v[i] = PyFloat_AsDouble(items[i]);
+        Py_DECREF(sequence);
+        if (PyErr_Occurred()) {
+            Py_DECREF(stripped);
+            SWIG_fail;
+        }
+    }
+    Py_DECREF(stripped);
+    $1 = &v;
+}
+
+/*
+ * The PLUMED log can be any Python file object backed by a file descriptor, such as sys.stdout or open(...).
+ * PLUMED writes to a duplicate of the descriptor, which the force owns and closes when the stream is replaced or
+ * when neither the force nor a Context created from it uses it any more.
+ */
+%typemap(in) FILE* stream {
+    PyObject* flushed = PyObject_CallMethod($input, "flush", NULL);
+    if (flushed == NULL)
+        PyErr_Clear();
+    Py_XDECREF(flushed);
+    int fd = PyObject_AsFileDescriptor($input);
+    if (fd < 0)
+        SWIG_fail;
+    int copy = dup(fd);
+    $1 = (copy < 0 ? NULL : fdopen(copy, "a"));
+    if ($1 == NULL) {
+        if (copy >= 0)
+            close(copy);
+        PyErr_SetFromErrno(PyExc_IOError);
+        SWIG_fail;
+    }
+}
+
+/* The labels of the recorded PLUMED values are passed as any sequence of strings and returned as a tuple. */
+%typemap(in) const std::vector<std::string>& labels (std::vector<std::string> v) {
+    PyObject* sequence = PySequence_Fast($input, "in method $symname, the labels must be a sequence of strings");
+    if (sequence == NULL)
+        SWIG_fail;
+    Py_ssize_t length = PySequence_Fast_GET_SIZE(sequence);
+    PyObject** items = PySequence_Fast_ITEMS(sequence);
+    for (Py_ssize_t i = 0; i < length; i++) {
+        const char* label = PyUnicode_AsUTF8(items[i]);
+        if (label == NULL) {
+            Py_DECREF(sequence);
+            SWIG_fail;
+        }
+        v.push_back(label);
+    }
+    Py_DECREF(sequence);
+    $1 = &v;
+}
+
+%typemap(out) const std::vector<std::string>& getCollectiveVariables {
+    $result = PyTuple_New($1->size());
+    for (size_t i = 0; i < $1->size(); i++)
+        PyTuple_SET_ITEM($result, i, PyUnicode_FromString((*$1)[i].c_str()));
+}
+
+/* getCollectiveVariableValues(context) returns the values as a tuple of floats. */
+%typemap(in, numinputs=0) std::vector<double>& values (std::vector<double> v) {
+    $1 = &v;
+}
+
+%typemap(argout) std::vector<double>& values {
+    Py_DECREF($result);
+    $result = PyTuple_New($1->size());
+    for (size_t i = 0; i < $1->size(); i++)
+        PyTuple_SET_ITEM($result, i, PyFloat_FromDouble((*$1)[i]));
+}
+
+/* PlumedAsyncStepper.readSnapshots() returns the snapshots as a float64 memoryview. */
+%typemap(in, numinputs=0) std::vector<double>& snapshots (std::vector<double> v) {
+    $1 = &v;
+}
+
+%typemap(argout) std::vector<double>& snapshots {
+    PyObject* bytes = PyBytes_FromStringAndSize($1->empty() ? NULL : (const char*) &(*$1)[0], $1->size()*sizeof(double));
+    PyObject* view = (bytes == NULL ? NULL : PyMemoryView_FromObject(bytes));
+    Py_XDECREF(bytes);
+    Py_DECREF($result);
+    $result = (view == NULL ? NULL : PyObject_CallMethod(view, "cast", "s", "d"));
+    Py_XDECREF(view);
+    if ($result == NULL)
+        SWIG_fail;
+}
+
+/*
+ * ExclusionFile.write() accepts an (N, 2) array of int32 through the buffer protocol, which is copied in one pass,
+ * or any sequence of pairs.
+ */
+%typemap(in) const std::vector<std::pair<int, int> >& pairs (std::vector<std::pair<int, int> > v) {
+    Py_buffer view;
+    bool copied = false;
+    if (PyObject_CheckBuffer($input) && PyObject_GetBuffer($input, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) == 0) {
+        if (view.ndim == 2 && view.shape[1] == 2 && view.itemsize == sizeof(int) && view.format != NULL && (strcmp(view.format, "i") == 0 || strcmp(view.format, "<i") == 0 || strcmp(view.format, "=i") == 0)) {
+            const int* data = (const int*) view.buf;
+            v.resize(view.shape[0]);
+            for (Py_ssize_t i = 0; i < view.shape[0]; i++)
+                v[i] = std::make_pair(data[2*i], data[2*i+1]);
+            copied = true;
+        }
+        PyBuffer_Release(&view);
+    }
+    PyErr_Clear();
+    if (!copied) {
+        PyObject* sequence = PySequence_Fast($input, "in method $symname, the pairs must be a sequence of (int, int)");
+        if (sequence == NULL)
+            SWIG_fail;
+        Py_ssize_t length = PySequence_Fast_GET_SIZE(sequence);
+        PyObject** items = PySequence_Fast_ITEMS(sequence);
+        v.resize(length);
+        for (Py_ssize_t i = 0; i < length; i++) {
+            PyObject* pair = PySequence_Tuple(items[i]);
+            int parsed = (pair != NULL && PyArg_ParseTuple(pair, "ii", &v[i].first, &v[i].second));
+            Py_XDECREF(pair);
+            if (!parsed) {
+                Py_DECREF(sequence);
+                SWIG_fail;
+            }
+        }
+        Py_DECREF(sequence);
+    }
+    $1 = &v;
+}
+
+/* swig/typemaps.i converts any sequence of three numbers to a Vec3. */
+%apply const Vec3& { const OpenMM::Vec3& };
+
+/* The log stream is reported as its file descriptor. */
+%typemap(out) FILE* {
+    $result = PyLong_FromLong($1 == NULL ? -1 : fileno($1));
+}
+
 namespace PlumedPlugin {
 
 class PlumedForce : public OpenMM::Force {
 public:
     PlumedForce(const std::string& script, const MPI_Comm intra_comm, const MPI_Comm inter_comm);
     const std::string& getScript() const;
+    MPI_Comm getIntracom() const;
+    MPI_Comm getIntercom() const;
+    bool usesPeriodicBoundaryConditions() const;
+    void setTemperature(double temperature);
+    double getTemperature() const;
+    void setMasses(const std::vector<double>& masses);
+    void setMassesFromTopologyRepartitioning(const OpenMM::System& system, double hmass);
+    FILE* getLogStream() const;
+    void setRestart(bool restart);
+    bool getRestart() const;
+    void setCollectiveVariables(const std::vector<std::string>& labels);
+    const std::vector<std::string>& getCollectiveVariables() const;
+    void setLoadBalanceReport(int interval, const std::string& filename);
+    int getLoadBalanceReportInterval() const;
+    const std::string& getLoadBalanceReportFile() const;
+    void setUseHardwareCounters(bool use);
+    bool getUseHardwareCounters() const;
+    void setDeterministic(bool deterministic);
+    bool getDeterministic() const;
+    void setUseNativeMetadynamics(bool use);
+    bool getUseNativeMetadynamics() const;
+    void setUseDeviceContactVariables(bool use);
+    bool getUseDeviceContactVariables() const;
+    void setReuseTolerance(double tolerance);
+    double getReuseTolerance() const;
+    void getCollectiveVariableValues(const OpenMM::Context& context, std::vector<double>& values) const;
+    double getBiasEnergy(const OpenMM::Context& context) const;
+};
+
+/*
+ * _getValueStorage() and _getSharedMasses() wrap the storage and the masses in capsules for the _views module, which
+ * turns them into memoryviews.  They create Python objects, so they keep the GIL.
+ */
+%nothread PlumedForce::_getValueStorage;
+%nothread PlumedForce::_getSharedMasses;
+%extend PlumedForce {
+    /* The stream created by the FILE* typemap is owned by the force, so it is closed once it is no longer used. */
+    void setLogStream(FILE* stream) {
+        $self->setLogStream(stream, true);
+    }
+
+    PyObject* _getSharedMasses() const {
+        std::shared_ptr<const std::vector<double> > masses = $self->getSharedMasses();
+        return PyCapsule_New(new std::shared_ptr<const std::vector<double> >(masses), "openmmplumed.Masses", deleteMassesCapsule);
+    }
+
+    PyObject* _getValueStorage(const OpenMM::Context& context) const {
+        std::shared_ptr<PlumedPlugin::PlumedValueStorage> storage = $self->getValueStorage(context);
+        return PyCapsule_New(new std::shared_ptr<PlumedPlugin::PlumedValueStorage>(storage), "openmmplumed.PlumedValueStorage", deleteValueStorageCapsule);
+    }
+
+    %pythoncode %{
+    def getValueViews(self, context):
+        """
+        Get read-only float64 memoryviews of the values this force records in a Context, as a ValueViews tuple
+        (bias, counters, values).  The views share memory with the plugin and are updated in place every time the
+        force is computed, so they only need to be created once.  See openmmplumed.views.
+        """
+        from . import views
+        return views.ValueViews(*views._views.views(self._getValueStorage(context)))
+
+    def getMasses(self):
+        """
+        Get the particle masses as a read-only float64 memoryview over the force's own buffer, which
+        numpy.asarray() wraps without copying.  An empty view means that the System masses are used.  setMasses()
+        replaces the buffer, so the view keeps the masses it was created from.
+        """
+        from . import views
+        return views._views.masses(self._getSharedMasses())
+    %}
+}
+
+class PlumedAsyncStepper {
+public:
+    PlumedAsyncStepper(OpenMM::Context& context, const PlumedForce& force, int stride, int capacity);
+    int getStride() const;
+    int getCapacity() const;
+    int getSnapshotSize() const;
+    void start(int steps);
+    bool isRunning() const;
+    void wait();
+    int readSnapshots(std::vector<double>& snapshots);
+    long long getNumDropped() const;
+};
+
+%newobject CalvadosSystemBuilder::createSystem;
+
+class CalvadosSystemBuilder {
+public:
+    CalvadosSystemBuilder();
+    void setResidueType(char code, double mass, double charge, double sigma, double lambda);
+    void loadResidueTable(const std::string& file, const std::string& lambdaColumn="lambdas");
+    int addChain(const std::string& sequence);
+    int getNumChains() const;
+    int getNumParticles() const;
+    void setTemperature(double temperature);
+    void setIonicStrength(double ionicStrength);
+    void setPH(double pH);
+    void setCutoffs(double yukawaCutoff, double ashbaughHatchCutoff);
+    void setBondParameters(double length, double k);
+    void setPeriodicBoxVectors(const OpenMM::Vec3& a, const OpenMM::Vec3& b, const OpenMM::Vec3& c);
+    OpenMM::System* createSystem() const;
+};
+
+class ExclusionFile {
+public:
+    static void write(const std::string& path, const std::vector<std::pair<int, int> >& pairs);
+    ExclusionFile(const std::string& path);
+    long long getNumPairs() const;
+    int addExclusionsTo(OpenMM::CustomNonbondedForce& force) const;
 };
 
 }
@@ -0,0 +1,49 @@
+import simtk.openmm as mm
+from openmmplumed import PlumedForce
+from openmmplumed.asyncstep import AsyncStepper
+from mpi4py import MPI
+import numpy as np
+import unittest
+
+
+class TestAsyncStep(unittest.TestCase):
+
+    def createContext(self):
+        system = mm.System()
+        for i in range(3):
+            system.addParticle(1.0)
+        force = PlumedForce('d: DISTANCE ATOMS=1,3\nBIASVALUE ARG=d', MPI.COMM_SELF, MPI.COMM_SELF)
+        force.setCollectiveVariables(['d'])
+        system.addForce(force)
+        integ = mm.VerletIntegrator(0.001)
+        context = mm.Context(system, integ, mm.Platform.getPlatformByName('Reference'))
+        context.setPositions([mm.Vec3(i, 0.1*i, -0.3*i) for i in range(3)])
+        return context, integ, force
+
+    def testStepAsync(self):
+        context, integ, force = self.createContext()
+        stepper = AsyncStepper(context, force, stride=5, capacity=100)
+        steps, bias, values = stepper.step_async(20).result()
+        self.assertEqual([4, 9, 14, 19], list(steps))
+        self.assertEqual((4, 1), values.shape)
+        self.assertTrue(np.allclose(bias, values[:, 0]))
+        self.assertEqual(20, context.getStepCount())
+
+        # The next chunk can be started while the results of the previous one are analyzed.
+
+        future = stepper.step_async(10)
+        steps, bias, values = future.result()
+        self.assertEqual([24, 29], list(steps))
+        self.assertEqual(values[-1, 0], force.getCollectiveVariableValues(context)[0])
+        self.assertEqual(0, stepper.getNumDropped())
+
+    def testRingBufferOverflow(self):
+        context, integ, force = self.createContext()
+        stepper = AsyncStepper(context, force, stride=1, capacity=3)
+        steps, bias, values = stepper.step_async(10).result()
+        self.assertEqual([7, 8, 9], list(steps))
+        self.assertEqual(7, stepper.getNumDropped())
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,50 @@
+import simtk.openmm as mm
+import simtk.unit as unit
+from openmmplumed.ensemble import ReplicaEnsemble
+from mpi4py import MPI
+import numpy as np
+import unittest
+
+
+class TestEnsemble(unittest.TestCase):
+
+    def testRun(self):
+        # Run a single replica and check the gathered values against its final state.
+
+        numParticles = 4
+        system = mm.System()
+        positions = np.empty((numParticles, 3))
+        for i in range(numParticles):
+            system.addParticle(1.0)
+            positions[i] = [i, 0.1*i, -0.3*i]
+        script = '''
+            d: DISTANCE ATOMS=1,3
+            BIASVALUE ARG=d
+        '''
+        integ = mm.LangevinIntegrator(300.0, 1.0, 0.001)
+        ensemble = ReplicaEnsemble(system, integ, script, positions, overrides=[{'temperature': 310.0, 'seed': 5}],
+                                   collectiveVariables=['d'], comm=MPI.COMM_SELF,
+                                   platform=mm.Platform.getPlatformByName('Reference'))
+        self.assertEqual(0, system.getNumForces())
+        self.assertEqual(310.0, ensemble.force.getTemperature())
+        ensemble.run(25, 10)
+        self.assertEqual([10, 20, 25], list(ensemble.steps))
+        self.assertEqual((3, 1), ensemble.potentialEnergies.shape)
+        self.assertEqual((3, 1, 1), ensemble.collectiveVariableValues.shape)
+        state = ensemble.context.getState(getPositions=True, getEnergy=True)
+        final = state.getPositions(asNumpy=True).value_in_unit(unit.nanometers)
+        dist = np.sqrt(np.sum((final[0]-final[2])**2))
+        self.assertAlmostEqual(dist, ensemble.collectiveVariableValues[-1, 0, 0], places=5)
+        self.assertAlmostEqual(dist, ensemble.biasEnergies[-1, 0], places=5)
+        self.assertAlmostEqual(state.getPotentialEnergy().value_in_unit(unit.kilojoules_per_mole), ensemble.potentialEnergies[-1, 0], places=5)
+        ensemble.close()
+
+    def testOverrideCount(self):
+        system = mm.System()
+        system.addParticle(1.0)
+        with self.assertRaises(ValueError):
+            ReplicaEnsemble(system, mm.VerletIntegrator(0.001), '', [mm.Vec3(0, 0, 0)], overrides=[{}, {}], comm=MPI.COMM_SELF)
+
+
+if __name__ == '__main__':
+    unittest.main()
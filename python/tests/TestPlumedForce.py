@@ -1,7 +1,13 @@
 import simtk.openmm as mm
 import simtk.unit as unit
-from openmmplumed import PlumedForce
+from openmmplumed import PlumedForce, views
+from openmmplumed.openmmplumed import PlumedAsyncStepper
+from mpi4py import MPI
 import numpy as np
+import os
+import sys
+import tempfile
+import threading
 import unittest
 
 
@@ -20,7 +26,7 @@ class TestTorchForce(unittest.TestCase):
             d: DISTANCE ATOMS=1,3
             BIASVALUE ARG=d
         '''
-        force = PlumedForce(script)
+        force = PlumedForce(script, MPI.COMM_SELF, MPI.COMM_SELF)
         system.addForce(force)
         integ = mm.LangevinIntegrator(300.0, 1.0, 1.0)
         context = mm.Context(system, integ, mm.Platform.getPlatformByName('Reference'))
@@ -38,6 +44,189 @@ class TestTorchForce(unittest.TestCase):
         self.assertTrue(np.allclose(delta/dist, state.getForces(asNumpy=True)[2]))
         self.assertTrue(np.allclose(zero, state.getForces(asNumpy=True)[3]))
 
+    def testSetters(self):
+        force = PlumedForce('d: DISTANCE ATOMS=1,2', MPI.COMM_SELF, MPI.COMM_WORLD)
+        self.assertEqual(MPI.COMM_SELF, force.getIntracom())
+        self.assertEqual(MPI.COMM_WORLD, force.getIntercom())
+
+        self.assertEqual(-1, force.getTemperature())
+        force.setTemperature(298.0)
+        self.assertEqual(298.0, force.getTemperature())
+
+        self.assertFalse(force.getRestart())
+        force.setRestart(True)
+        self.assertTrue(force.getRestart())
+
+        self.assertEqual(0, force.getLoadBalanceReportInterval())
+        force.setLoadBalanceReport(100, 'balance.txt')
+        self.assertEqual(100, force.getLoadBalanceReportInterval())
+        self.assertEqual('balance.txt', force.getLoadBalanceReportFile())
+
+        self.assertFalse(force.getUseHardwareCounters())
+        force.setUseHardwareCounters(True)
+        self.assertTrue(force.getUseHardwareCounters())
+
+        self.assertFalse(force.getDeterministic())
+        force.setDeterministic(True)
+        self.assertTrue(force.getDeterministic())
+
+        self.assertFalse(force.getUseNativeMetadynamics())
+        force.setUseNativeMetadynamics(True)
+        self.assertTrue(force.getUseNativeMetadynamics())
+
+        self.assertFalse(force.getUseDeviceContactVariables())
+        force.setUseDeviceContactVariables(True)
+        self.assertTrue(force.getUseDeviceContactVariables())
+
+        self.assertEqual(0.0, force.getReuseTolerance())
+        force.setReuseTolerance(0.01)
+        self.assertEqual(0.01, force.getReuseTolerance())
+
+        self.assertEqual(0, len(force.getMasses()))
+        masses = np.array([1.008, 12.011, 15.999])
+        force.setMasses(masses)
+        self.assertTrue(np.array_equal(masses, np.asarray(force.getMasses())))
+        self.assertTrue(force.getMasses().readonly)
+        view = np.asarray(force.getMasses())
+        self.assertFalse(view.flags.owndata)
+        self.assertTrue(np.shares_memory(view, np.asarray(force.getMasses())))
+        force.setMasses([3.0, 4.0])
+        self.assertEqual([3.0, 4.0], force.getMasses().tolist())
+        force.setMasses([])
+        self.assertEqual(0, len(force.getMasses()))
+
+        system = mm.System()
+        for mass in [12.011-2*(3.0-1.007947), 3.0, 3.0]:
+            system.addParticle(mass)
+        system.addConstraint(0, 1, 0.1)
+        system.addConstraint(0, 2, 0.1)
+        force.setMassesFromTopologyRepartitioning(system, 3.0*unit.dalton)
+        self.assertTrue(np.allclose([12.011, 1.007947, 1.007947], force.getMasses()))
+
+        force.setLogStream(sys.stdout)
+        self.assertNotEqual(-1, force.getLogStream())
+
+    def testLogStreamIsClosed(self):
+        # Every setLogStream() call duplicates the descriptor.  The duplicate has to be closed when it is replaced
+        # and when the force is deleted.
+
+        if not os.path.isdir('/proc/self/fd'):
+            self.skipTest('needs /proc/self/fd')
+        with tempfile.TemporaryFile('w') as log:
+            force = PlumedForce('', MPI.COMM_SELF, MPI.COMM_SELF)
+            force.setLogStream(log)
+            before = len(os.listdir('/proc/self/fd'))
+            for i in range(10):
+                force.setLogStream(log)
+            self.assertEqual(before, len(os.listdir('/proc/self/fd')))
+            del force
+            self.assertEqual(before-1, len(os.listdir('/proc/self/fd')))
+
+    def testValueViews(self):
+        # The memoryviews are created once and follow every later force computation.
+
+        system = mm.System()
+        positions = np.array([[0.0, 0.0, 0.0], [0.5, 0.0, 0.0], [1.0, 0.0, 0.0]])
+        for i in range(3):
+            system.addParticle(1.0)
+        force = PlumedForce('d: DISTANCE ATOMS=1,3\nBIASVALUE ARG=d', MPI.COMM_SELF, MPI.COMM_SELF)
+        force.setCollectiveVariables(['d'])
+        self.assertEqual(('d',), force.getCollectiveVariables())
+        system.addForce(force)
+        integ = mm.VerletIntegrator(0.001)
+        context = mm.Context(system, integ, mm.Platform.getPlatformByName('Reference'))
+        context.setPositions(positions)
+        bias, counters, values = force.getValueViews(context)
+        self.assertTrue(values.readonly)
+        self.assertEqual('d', values.format)
+        self.assertEqual(1, len(values))
+        for i in range(3):
+            positions[2, 0] += 0.1
+            context.setPositions(positions)
+            integ.step(1)
+            context.getState(getEnergy=True)
+            self.assertAlmostEqual(positions[2, 0], values[0], places=5)
+            self.assertAlmostEqual(positions[2, 0], bias[0], places=5)
+            self.assertEqual(values[0], force.getCollectiveVariableValues(context)[0])
+        self.assertGreaterEqual(counters[views.NumCalculations], 6)
+        self.assertGreater(counters[views.CalculationTime], 0)
+
+    def testReleasesGIL(self):
+        # Run PLUMED in the plugin's own stepping thread and block in PlumedAsyncStepper.wait() while another Python
+        # thread counts.  The switch interval is raised so the counter can only advance if the wrapped plugin call
+        # releases the GIL while it waits for the PLUMED calculations.
+
+        system = mm.System()
+        system.addParticle(1.0)
+        external = mm.CustomExternalForce('x^2')
+        external.addParticle(0)
+        system.addForce(external)
+        script = '''
+            p: POSITION ATOM=1
+            METAD ARG=p.x SIGMA=0.5 HEIGHT=0.1 PACE=1
+        '''
+        force = PlumedForce(script, MPI.COMM_SELF, MPI.COMM_SELF)
+        force.setCollectiveVariables(['p.x'])
+        system.addForce(force)
+        integ = mm.LangevinIntegrator(300.0, 1.0, 0.001)
+        context = mm.Context(system, integ, mm.Platform.getPlatformByName('Reference'))
+        context.setPositions([mm.Vec3(0, 0, 0)])
+        integ.step(1)
+        stepper = PlumedAsyncStepper(context, force, 1, 10)
+
+        count = [0]
+        running = threading.Event()
+        done = threading.Event()
+        def work():
+            running.set()
+            while not done.is_set():
+                count[0] += 1
+        switchInterval = sys.getswitchinterval()
+        thread = threading.Thread(target=work)
+        thread.start()
+        running.wait()
+        sys.setswitchinterval(0.5)
+        try:
+            before = count[0]
+            stepper.start(2000)
+            stepper.wait()
+            after = count[0]
+        finally:
+            sys.setswitchinterval(switchInterval)
+            done.set()
+            thread.join()
+        self.assertGreater(after, before)
+        self.assertEqual(2001, context.getStepCount())
+
+    def testMultipleTimeStep(self):
+        # Put PLUMED in a slow force group that MTSIntegrator computes once per step, after moving the particles.
+
+        numParticles = 4
+        system = mm.System()
+        bonds = mm.HarmonicBondForce()
+        positions = np.empty((numParticles, 3))
+        for i in range(numParticles):
+            system.addParticle(1.0)
+            positions[i] = [0.3*i, 0.1*(i%2), -0.05*i]
+            if i > 0:
+                bonds.addBond(i-1, i, 0.3, 5000.0)
+        system.addForce(bonds)
+        force = PlumedForce('d: DISTANCE ATOMS=1,3', MPI.COMM_SELF, MPI.COMM_SELF)
+        force.setCollectiveVariables(['d'])
+        force.setForceGroup(1)
+        system.addForce(force)
+        integ = mm.MTSIntegrator(0.002, [(1, 1), (0, 4)])
+        context = mm.Context(system, integ, mm.Platform.getPlatformByName('Reference'))
+        context.setPositions(positions)
+        context.setVelocitiesToTemperature(300.0)
+
+        # The value recorded by each step's update is the distance at the end of the step.
+
+        for i in range(10):
+            integ.step(1)
+            positions = context.getState(getPositions=True).getPositions(asNumpy=True).value_in_unit(unit.nanometers)
+            dist = np.sqrt(np.sum((positions[0]-positions[2])**2))
+            self.assertAlmostEqual(dist, force.getCollectiveVariableValues(context)[0])
 
 if __name__ == '__main__':
-    unittest.main()
\ No newline at end of file
+    unittest.main()
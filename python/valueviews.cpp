@@ -0,0 +1,150 @@
+/* -------------------------------------------------------------------------- *
+ *                              OpenMM-PLUMED                                 *
+ * -------------------------------------------------------------------------- *
+ * This module exposes the PlumedValueStorage of a PlumedForce to Python as   *
+ * read-only float64 memoryviews, without copying and without going through  *
+ * SWIG on every read.                                                        *
+ * -------------------------------------------------------------------------- */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include "PlumedValueStorage.h"
+#include <memory>
+#include <vector>
+
+using namespace PlumedPlugin;
+
+/*
+ * The capsules created by PlumedForce._getValueStorage() hold a heap allocated shared_ptr to the storage, and those
+ * created by PlumedForce._getSharedMasses() one to the masses.
+ */
+static const char* capsuleName = "openmmplumed.PlumedValueStorage";
+static const char* massesCapsuleName = "openmmplumed.Masses";
+
+/*
+ * A Block exports one range of the storage, or the masses, through the buffer protocol.  It keeps a reference to
+ * the capsule, so the memory outlives every memoryview created from it.
+ */
+typedef struct {
+    PyObject_HEAD
+    PyObject* capsule;
+    double* data;
+    Py_ssize_t length;
+    Py_ssize_t itemsize;
+} Block;
+
+static void Block_dealloc(Block* self) {
+    Py_XDECREF(self->capsule);
+    Py_TYPE(self)->tp_free((PyObject*) self);
+}
+
+static int Block_getbuffer(Block* self, Py_buffer* view, int flags) {
+    if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "the PLUMED values are read-only");
+        view->obj = NULL;
+        return -1;
+    }
+    view->obj = (PyObject*) self;
+    Py_INCREF(self);
+    view->buf = self->data;
+    view->len = self->length*self->itemsize;
+    view->readonly = 1;
+    view->itemsize = self->itemsize;
+    view->format = ((flags & PyBUF_FORMAT) == PyBUF_FORMAT ? (char*) "d" : NULL);
+    view->ndim = 1;
+    view->shape = ((flags & PyBUF_ND) == PyBUF_ND ? &self->length : NULL);
+    view->strides = ((flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &self->itemsize : NULL);
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    return 0;
+}
+
+static PyBufferProcs Block_as_buffer = {
+    (getbufferproc) Block_getbuffer,
+    NULL
+};
+
+static PyTypeObject BlockType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "openmmplumed._views.Block",
+};
+
+static PyObject* createView(PyObject* capsule, double* data, Py_ssize_t length) {
+    Block* block = PyObject_New(Block, &BlockType);
+    if (block == NULL)
+        return NULL;
+    Py_INCREF(capsule);
+    block->capsule = capsule;
+    block->data = data;
+    block->length = length;
+    block->itemsize = sizeof(double);
+    PyObject* view = PyMemoryView_FromObject((PyObject*) block);
+    Py_DECREF(block);
+    return view;
+}
+
+/* views(capsule) returns the memoryviews (bias, counters, values) over the storage held by the capsule. */
+static PyObject* views(PyObject* module, PyObject* capsule) {
+    std::shared_ptr<PlumedValueStorage>* pointer = (std::shared_ptr<PlumedValueStorage>*) PyCapsule_GetPointer(capsule, capsuleName);
+    if (pointer == NULL)
+        return NULL;
+    PlumedValueStorage& storage = **pointer;
+    PyObject* bias = createView(capsule, &storage.getBias(), 1);
+    PyObject* counters = createView(capsule, storage.getCounters(), PlumedValueStorage::NumCounters);
+    PyObject* values = createView(capsule, storage.getValues(), storage.getNumValues());
+    if (bias == NULL || counters == NULL || values == NULL) {
+        Py_XDECREF(bias);
+        Py_XDECREF(counters);
+        Py_XDECREF(values);
+        return NULL;
+    }
+    return Py_BuildValue("(NNN)", bias, counters, values);
+}
+
+/* masses(capsule) returns a memoryview over the masses held by the capsule. */
+static PyObject* masses(PyObject* module, PyObject* capsule) {
+    std::shared_ptr<const std::vector<double> >* pointer = (std::shared_ptr<const std::vector<double> >*) PyCapsule_GetPointer(capsule, massesCapsuleName);
+    if (pointer == NULL)
+        return NULL;
+    const std::vector<double>& values = **pointer;
+    return createView(capsule, (double*) values.data(), values.size());
+}
+
+static PyMethodDef methods[] = {
+    {"views", (PyCFunction) views, METH_O, "Return the memoryviews (bias, counters, values) of a PlumedValueStorage."},
+    {"masses", (PyCFunction) masses, METH_O, "Return a memoryview of the masses of a PlumedForce."},
+    {NULL, NULL, 0, NULL}
+};
+
+static struct PyModuleDef moduleDef = {
+    PyModuleDef_HEAD_INIT,
+    "_views",
+    "Zero-copy views of the values recorded by a PlumedForce.",
+    -1,
+    methods
+};
+
+PyMODINIT_FUNC PyInit__views(void) {
+    BlockType.tp_basicsize = sizeof(Block);
+    BlockType.tp_flags = Py_TPFLAGS_DEFAULT;
+    BlockType.tp_dealloc = (destructor) Block_dealloc;
+    BlockType.tp_as_buffer = &Block_as_buffer;
+    BlockType.tp_doc = "A range of a PlumedValueStorage exported through the buffer protocol.";
+    if (PyType_Ready(&BlockType) < 0)
+        return NULL;
+    PyObject* module = PyModule_Create(&moduleDef);
+    if (module == NULL)
+        return NULL;
+    PyModule_AddIntConstant(module, "NumCalculations", PlumedValueStorage::NumCalculations);
+    PyModule_AddIntConstant(module, "CalculationTime", PlumedValueStorage::CalculationTime);
+    PyModule_AddIntConstant(module, "TransferTime", PlumedValueStorage::TransferTime);
+    PyModule_AddIntConstant(module, "ReplicaWaitTime", PlumedValueStorage::ReplicaWaitTime);
+    PyModule_AddIntConstant(module, "CalculationCycles", PlumedValueStorage::CalculationCycles);
+    PyModule_AddIntConstant(module, "CalculationInstructions", PlumedValueStorage::CalculationInstructions);
+    PyModule_AddIntConstant(module, "CalculationCacheMisses", PlumedValueStorage::CalculationCacheMisses);
+    PyModule_AddIntConstant(module, "TransferCycles", PlumedValueStorage::TransferCycles);
+    PyModule_AddIntConstant(module, "TransferInstructions", PlumedValueStorage::TransferInstructions);
+    PyModule_AddIntConstant(module, "TransferCacheMisses", PlumedValueStorage::TransferCacheMisses);
+    PyModule_AddIntConstant(module, "ReusedCalculations", PlumedValueStorage::ReusedCalculations);
+    return module;
+}
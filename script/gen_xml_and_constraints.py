@@ -1,6 +1,6 @@
 import pandas as pd
 import numpy as np
-import pickle
+import struct
 import mdtraj as md
 import sys
 
@@ -96,12 +96,17 @@ def generate_forcefield_xml(fasta, residues, xml_name):
     with open(xml_name, "w") as f:
         f.write(xml_output)
 		
+def write_exclusions_file(excl, file_name):
+    # Binary exclusion list read by openmmplumed.ExclusionFile: "OMMPEXCL", uint32 version (1), uint32 reserved (0),
+    # uint64 number of pairs, then the pairs as little endian int32.
+    excl = np.ascontiguousarray(excl, dtype='<i4').reshape(-1, 2)
+    with open(file_name, 'wb') as fp:
+        fp.write(b'OMMPEXCL' + struct.pack('<IIQ', 1, 0, len(excl)))
+        fp.write(excl.tobytes())
+
 def create_exclusions_file(n_res):
-    excl = []
-    for i in range(n_res-1):
-        excl.append([i,i+1])
-    with open('r1_excl.pkl', 'wb') as fp:
-        pickle.dump(excl, fp)
+    excl = np.stack([np.arange(n_res-1), np.arange(1, n_res)], axis=1)
+    write_exclusions_file(excl, 'r1_excl.bin')
 
 fasta_file = open(sys.argv[1],mode='r')
 fasta = fasta_file.read().replace("\n","")
@@ -2,76 +2,37 @@ from openmm.app import *
 from openmm import *
 from openmm.unit import *
 from sys import stdout
-import pandas as pd
 import numpy as np
-import pickle
-import mdtraj as md
 from mpi4py import MPI
-from openmmplumed import PlumedForce
+from openmmplumed import PlumedForce, CalvadosSystemBuilder, ExclusionFile
 comm1 = MPI.COMM_SELF
 comm2 = MPI.COMM_WORLD
 
-residues = pd.read_csv("residues.csv").set_index('one')
-
 fasta = """MSEYIRVTEDENDEPIEIPSEDDGTVLLSTVTAQFPGACGLRYRNPVSQCMRGVRLVEGILHAPDAGWGNLVYVVNYPKDNKRKMDETDASSAVKVKRAVQKTSDLIVLGLPWKTTEQDLKEYFSTFGEVLMVQVKKDLKTGHSKGFGFVRFTEYETQVKVMSQRHMIDGRWCDCKLPNSKQSQDEPLRSRKVFVGRCTEDMTEDELREFFSQYGDVMDVFIPKPFRAFAFVTFADDQIAQSLCGEDLIIKGISVHISNAEPKHNSNRQLERSGRFGGNPGGFGNQGGFGNSRGGGAGLGNNQGSNMGGGMNFGAFSINPAMMAAAQAALQSSWGMMGMLASQQNQSGPSGNNQNQGNMQREPNQAFGSGNNSYSGSNSGAAIGWGSASNAGSGSGFNGGFGSSMDSKSSGWGM""".replace('\n', '')
 
-def adjust_terminals_HIS(r,pH,fasta):
-    r.loc['H','q'] = 1. / ( 1 + 10**(pH-6) )
-    r.loc['X'] = r.loc[fasta[0]]
-    r.loc['X','q'] = r.loc[fasta[0],'q'] + 1.
-    r.loc['X','MW'] = r.loc[fasta[0],'MW'] + 2.
-    r.loc['X','three'] = 'X'
-    
-    r.loc['Z'] = r.loc[fasta[-1]]
-    r.loc['Z','q'] = r.loc[fasta[-1],'q'] - 1.
-    r.loc['Z','MW'] = r.loc[fasta[-1],'MW'] + 16.
-    r.loc['Z','three'] = 'Z'
-    
-    return r.set_index('three')
-
-residues = adjust_terminals_HIS(residues,7.4,fasta)
-
-atomic_number = 117
-for i,r in residues.iterrows():
-    name = 'carbon-{}'.format(i)
-    symbol = 'C-{}'.format(i)
-    new_element = Element(atomic_number,name,symbol,r.MW*dalton)
-    atomic_number += 1
-
 pdb = PDBFile('input.pdb')
 
 top = pdb.topology
 
-for chain in top._chains:
-    for residue in chain._residues:
-        for atom in residue._atoms:
-            atom.element = Element._elements_by_symbol['C-{}'.format(residue.name)]
-            
-atoms = list(top.atoms())
-
-for i in range(len(fasta)-1):
-    top.addBond(atoms[i],atoms[i+1])
-    
-forcefield = ForceField("calvados.xml")
+# Build the bonds, Yukawa and Ashbaugh-Hatch forces (with the bonded exclusions) in C++, at 298 K, 0.2 M and pH 7.4.
 
-system = forcefield.createSystem(top,nonbondedMethod=CutoffNonPeriodic)
+builder = CalvadosSystemBuilder()
+builder.loadResidueTable("residues.csv")
+builder.addChain(fasta)
+builder.setCutoffs(4, 2)
+system = builder.createSystem()
 
-system.removeForce(3)
+# Apply the exclusion list (e.g. structured-domain exclusions) to both nonbonded forces.  Pairs that are already
+# excluded, such as the bonds, are skipped.
 
+exclusions = ExclusionFile('r1_excl.bin')
+exclusions.addExclusionsTo(system.getForce(1))
+exclusions.addExclusionsTo(system.getForce(2))
 
-with open('r1_excl.pkl', 'rb') as fp:
-    r1_exclusions = pickle.load(fp)
-    
-forces = system.getForces()
+atoms = list(top.atoms())
 
-forces[1].setCutoffDistance(4*nanometers)
-for bond in r1_exclusions:
-    forces[1].addExclusion(bond[0],bond[1])
-    
-forces[2].setForceGroup(1)
-forces[2].setCutoffDistance(2*nanometers)
-for bond in r1_exclusions:
-    forces[2].addExclusion(bond[0],bond[1])
+for i in range(len(fasta)-1):
+    top.addBond(atoms[i],atoms[i+1])
 
 #sample script
 script = """MOLINFO MOLTYPE=protein STRUCTURE=input.pdb
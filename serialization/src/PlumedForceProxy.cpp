@@ -41,7 +41,7 @@ PlumedForceProxy::PlumedForceProxy() : SerializationProxy("PlumedForce") {
 }
 
 void PlumedForceProxy::serialize(const void* object, SerializationNode& node) const {
-    node.setIntProperty("version", 4);
+    node.setIntProperty("version", 5);
     const PlumedForce& force = *reinterpret_cast<const PlumedForce*>(object);
     node.setStringProperty("script", force.getScript());
     node.setDoubleProperty("temperature", force.getTemperature());
@@ -49,14 +49,27 @@ void PlumedForceProxy::serialize(const void* object, SerializationNode& node) co
     for (const auto& mass: force.getMasses())
         particles.createChildNode("particle").setDoubleProperty("mass", mass);
     node.setBoolProperty("restart", force.getRestart());
+    node.setIntProperty("forceGroup", force.getForceGroup());
+    auto& variables = node.createChildNode("collectiveVariables");
+    for (const auto& label: force.getCollectiveVariables())
+        variables.createChildNode("variable").setStringProperty("label", label);
+    node.setIntProperty("loadBalanceInterval", force.getLoadBalanceReportInterval());
+    node.setStringProperty("loadBalanceFile", force.getLoadBalanceReportFile());
+    node.setBoolProperty("useHardwareCounters", force.getUseHardwareCounters());
+    node.setBoolProperty("deterministic", force.getDeterministic());
+    node.setBoolProperty("useNativeMetadynamics", force.getUseNativeMetadynamics());
+    node.setBoolProperty("useDeviceContactVariables", force.getUseDeviceContactVariables());
+    node.setDoubleProperty("reuseTolerance", force.getReuseTolerance());
 }
 
 void* PlumedForceProxy::deserialize(const SerializationNode& node) const {
     const int version = node.getIntProperty("version");
-    if (version < 1 || version > 4)
+    if (version < 1 || version > 5)
         throw OpenMMException("Unsupported version number");
 
-    PlumedForce* force = new PlumedForce(node.getStringProperty("script"));
+    // Communicators cannot be serialized, so a deserialized force runs a single replica of its own.
+
+    PlumedForce* force = new PlumedForce(node.getStringProperty("script"), MPI_COMM_SELF, MPI_COMM_SELF);
     if (version > 1)
         force->setRestart(node.getBoolProperty("restart"));
     if (version > 2)
@@ -67,6 +80,19 @@ void* PlumedForceProxy::deserialize(const SerializationNode& node) const {
             masses.push_back(particle.getDoubleProperty("mass"));
         force->setMasses(masses);
     }
+    if (version > 4) {
+        force->setForceGroup(node.getIntProperty("forceGroup"));
+        std::vector<std::string> labels;
+        for (const auto& variable: node.getChildNode("collectiveVariables").getChildren())
+            labels.push_back(variable.getStringProperty("label"));
+        force->setCollectiveVariables(labels);
+        force->setLoadBalanceReport(node.getIntProperty("loadBalanceInterval"), node.getStringProperty("loadBalanceFile"));
+        force->setUseHardwareCounters(node.getBoolProperty("useHardwareCounters"));
+        force->setDeterministic(node.getBoolProperty("deterministic"));
+        force->setUseNativeMetadynamics(node.getBoolProperty("useNativeMetadynamics"));
+        force->setUseDeviceContactVariables(node.getBoolProperty("useDeviceContactVariables"));
+        force->setReuseTolerance(node.getDoubleProperty("reuseTolerance"));
+    }
 
     return force;
 }
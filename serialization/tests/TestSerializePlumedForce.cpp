@@ -50,10 +50,19 @@ void testSerialization() {
     bool restart = true;
     double temperature = 42.0;
     const std::vector<double> masses = {3.1, 4.1, 5.9};
-    PlumedForce force(script);
+    const std::vector<std::string> labels = {"d", "d.x"};
+    PlumedForce force(script, MPI_COMM_SELF, MPI_COMM_SELF);
     force.setRestart(restart);
     force.setTemperature(temperature);
     force.setMasses(masses);
+    force.setForceGroup(3);
+    force.setCollectiveVariables(labels);
+    force.setLoadBalanceReport(25, "balance.txt");
+    force.setUseHardwareCounters(true);
+    force.setDeterministic(true);
+    force.setUseNativeMetadynamics(true);
+    force.setUseDeviceContactVariables(true);
+    force.setReuseTolerance(0.002);
 
     // Serialize and then deserialize it.
 
@@ -68,12 +77,45 @@ void testSerialization() {
     ASSERT_EQUAL(restart, force2.getRestart());
     ASSERT_EQUAL(temperature, force2.getTemperature());
     ASSERT_EQUAL_CONTAINERS(masses, force2.getMasses());
+    ASSERT_EQUAL(3, force2.getForceGroup());
+    ASSERT_EQUAL_CONTAINERS(labels, force2.getCollectiveVariables());
+    ASSERT_EQUAL(25, force2.getLoadBalanceReportInterval());
+    ASSERT_EQUAL("balance.txt", force2.getLoadBalanceReportFile());
+    ASSERT(force2.getUseHardwareCounters());
+    ASSERT(force2.getDeterministic());
+    ASSERT(force2.getUseNativeMetadynamics());
+    ASSERT(force2.getUseDeviceContactVariables());
+    ASSERT_EQUAL(0.002, force2.getReuseTolerance());
+    delete copy;
+}
+
+void testReadVersion4() {
+    // Forces serialized before the settings were added keep their defaults.
+
+    string xml = "<Force type=\"PlumedForce\" restart=\"1\" script=\"d: DISTANCE ATOMS=1,3\" temperature=\"300\" version=\"4\">"
+                 "<particles><particle mass=\"2\"/></particles></Force>";
+    stringstream buffer(xml);
+    PlumedForce* force = XmlSerializer::deserialize<PlumedForce>(buffer);
+    ASSERT_EQUAL("d: DISTANCE ATOMS=1,3", force->getScript());
+    ASSERT(force->getRestart());
+    ASSERT_EQUAL(300.0, force->getTemperature());
+    ASSERT_EQUAL_CONTAINERS(std::vector<double>({2.0}), force->getMasses());
+    ASSERT_EQUAL(0, force->getForceGroup());
+    ASSERT_EQUAL(0, force->getCollectiveVariables().size());
+    ASSERT_EQUAL(0, force->getLoadBalanceReportInterval());
+    ASSERT(!force->getUseHardwareCounters());
+    ASSERT(!force->getDeterministic());
+    ASSERT(!force->getUseNativeMetadynamics());
+    ASSERT(!force->getUseDeviceContactVariables());
+    ASSERT_EQUAL(0.0, force->getReuseTolerance());
+    delete force;
 }
 
 int main() {
     try {
         registerPlumedSerializationProxies();
         testSerialization();
+        testReadVersion4();
     }
     catch(const exception& e) {
         cout << "exception: " << e.what() << endl;
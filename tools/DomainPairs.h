@@ -0,0 +1,88 @@
+#ifndef OPENMM_DOMAINPAIRS_H_
+#define OPENMM_DOMAINPAIRS_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * A residue of a coarse-grained structure read by GenerateExclusions, with its position in nm.
+ */
+struct Residue {
+    double x, y, z;
+    int chain, number;
+    char chainId;
+};
+
+/**
+ * Find all pairs of residues that belong to the same domain of the same chain and are closer than the cutoff.
+ * The residues of all domains are sorted into cubic cells of the cutoff size, and each residue is only compared to
+ * those in its own and the 26 neighboring cells.
+ */
+inline void findDomainPairs(const std::vector<Residue>& residues, const std::vector<int>& domainOfResidue, double cutoff, std::vector<std::pair<int, int> >& pairs) {
+    std::unordered_map<long long, std::vector<int> > cells;
+    auto cellIndex = [&](int x, int y, int z) {
+        return ((long long) (x+(1<<20))<<42) | ((long long) (y+(1<<20))<<21) | (long long) (z+(1<<20));
+    };
+    auto cellOf = [&](double coordinate) {
+        return (int) std::floor(coordinate/cutoff);
+    };
+    for (int i = 0; i < residues.size(); i++)
+        if (domainOfResidue[i] != -1)
+            cells[cellIndex(cellOf(residues[i].x), cellOf(residues[i].y), cellOf(residues[i].z))].push_back(i);
+    double cutoff2 = cutoff*cutoff;
+    for (int i = 0; i < residues.size(); i++) {
+        if (domainOfResidue[i] == -1)
+            continue;
+        const Residue& r1 = residues[i];
+        int cx = cellOf(r1.x), cy = cellOf(r1.y), cz = cellOf(r1.z);
+        for (int dx = -1; dx <= 1; dx++)
+            for (int dy = -1; dy <= 1; dy++)
+                for (int dz = -1; dz <= 1; dz++) {
+                    auto cell = cells.find(cellIndex(cx+dx, cy+dy, cz+dz));
+                    if (cell == cells.end())
+                        continue;
+                    for (int j : cell->second) {
+                        if (j <= i || domainOfResidue[j] != domainOfResidue[i] || residues[j].chain != r1.chain)
+                            continue;
+                        double ddx = residues[j].x-r1.x, ddy = residues[j].y-r1.y, ddz = residues[j].z-r1.z;
+                        if (ddx*ddx+ddy*ddy+ddz*ddz < cutoff2)
+                            pairs.push_back(std::make_pair(i, j));
+                    }
+                }
+    }
+}
+
+#endif /*OPENMM_DOMAINPAIRS_H_*/
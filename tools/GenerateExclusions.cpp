@@ -0,0 +1,114 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This program writes the exclusion list of a coarse-grained system (one particle per residue) in the binary format
+ * read by ExclusionFile.  It excludes every pair of consecutive residues in a chain and, for each structured domain,
+ * every pair of residues in the domain that are closer than a cutoff in the input structure.  The close pairs are
+ * found with a cell list, so the cost grows linearly with the number of residues.
+ *
+ * Usage: GenerateExclusions input.pdb output.bin [--cutoff nm] [--domain [chain:]first-last]... [--no-bonds]
+ *
+ * The structure must have one ATOM or HETATM record per residue, such as only the CA atoms of an all-atom
+ * structure.  Chains are separated by TER records or changes of the chain identifier.  A domain is a range of residue numbers
+ * (as written in the PDB file).  Without a chain identifier it applies to every chain, which is convenient for
+ * systems made of many copies of the same molecule.
+ */
+
+#include "DomainPairs.h"
+#include "ExclusionFile.h"
+#include "ResidueInput.h"
+#include "openmm/OpenMMException.h"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace PlumedPlugin;
+using namespace OpenMM;
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        cerr << "Usage: " << argv[0] << " input.pdb output.bin [--cutoff nm] [--domain [chain:]first-last]... [--no-bonds]" << endl;
+        return 1;
+    }
+    try {
+        double cutoff = 0.9;
+        bool bonds = true;
+        vector<Domain> domains;
+        for (int i = 3; i < argc; i++) {
+            string arg = argv[i];
+            if (arg == "--cutoff" && i+1 < argc)
+                cutoff = atof(argv[++i]);
+            else if (arg == "--domain" && i+1 < argc)
+                domains.push_back(parseDomain(argv[++i]));
+            else if (arg == "--no-bonds")
+                bonds = false;
+            else
+                throw OpenMMException("unknown argument "+arg);
+        }
+        if (cutoff <= 0)
+            throw OpenMMException("the cutoff must be positive");
+        vector<Residue> residues = readPdb(argv[1]);
+
+        // Assign every residue to the domain it belongs to, if any.
+
+        vector<int> domainOfResidue(residues.size(), -1);
+        for (int i = 0; i < residues.size(); i++)
+            for (int d = 0; d < domains.size(); d++)
+                if ((domains[d].chainId == 0 || domains[d].chainId == residues[i].chainId) &&
+                        residues[i].number >= domains[d].first && residues[i].number <= domains[d].last) {
+                    domainOfResidue[i] = d;
+                    break;
+                }
+
+        // Collect the pairs, sorted and without duplicates.
+
+        vector<pair<int, int> > pairs;
+        if (bonds)
+            for (int i = 1; i < residues.size(); i++)
+                if (residues[i].chain == residues[i-1].chain)
+                    pairs.push_back(make_pair(i-1, i));
+        findDomainPairs(residues, domainOfResidue, cutoff, pairs);
+        sort(pairs.begin(), pairs.end());
+        pairs.erase(unique(pairs.begin(), pairs.end()), pairs.end());
+        ExclusionFile::write(argv[2], pairs);
+        cout << residues.size() << " residues in " << (residues.empty() ? 0 : residues.back().chain+1) << " chains, " << pairs.size() << " exclusions written to " << argv[2] << endl;
+    }
+    catch (const exception& ex) {
+        cerr << "GenerateExclusions: " << ex.what() << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+#ifndef OPENMM_RESIDUEINPUT_H_
+#define OPENMM_RESIDUEINPUT_H_
+
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+#include "DomainPairs.h"
+#include "openmm/OpenMMException.h"
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * A range of residue numbers of GenerateExclusions.  A chainId of 0 stands for every chain.
+ */
+struct Domain {
+    char chainId;
+    int first, last;
+};
+
+/**
+ * Read the residues of a coarse-grained PDB structure, which must have one ATOM or HETATM record per residue.  An
+ * all-atom structure is rejected, since its atom indices would be written as if they were residues.
+ */
+inline std::vector<Residue> readPdb(const std::string& file) {
+    std::ifstream input(file.c_str());
+    if (!input.is_open())
+        throw OpenMM::OpenMMException("cannot open "+file);
+    std::vector<Residue> residues;
+    std::set<int> chainResidues;
+    std::string line;
+    int chain = 0;
+    bool chainEnded = false;
+    while (std::getline(input, line)) {
+        if (line.compare(0, 3, "TER") == 0 || line.compare(0, 6, "ENDMDL") == 0) {
+            chainEnded = true;
+            if (line.compare(0, 6, "ENDMDL") == 0)
+                break;
+            continue;
+        }
+        if (line.compare(0, 4, "ATOM") != 0 && line.compare(0, 6, "HETATM") != 0)
+            continue;
+        if (line.size() < 54)
+            throw OpenMM::OpenMMException("malformed line in "+file+": "+line);
+        Residue residue;
+        residue.chainId = line[21];
+        residue.number = std::atoi(line.substr(22, 4).c_str());
+        residue.x = std::atof(line.substr(30, 8).c_str())*0.1;
+        residue.y = std::atof(line.substr(38, 8).c_str())*0.1;
+        residue.z = std::atof(line.substr(46, 8).c_str())*0.1;
+        if (!residues.empty() && (chainEnded || residue.chainId != residues.back().chainId)) {
+            chain++;
+            chainResidues.clear();
+        }
+        chainEnded = false;
+        if (!chainResidues.insert(residue.number).second)
+            throw OpenMM::OpenMMException("residue "+std::to_string(residue.number)+" appears more than once in a chain of "+file+
+                    ", which must have one particle per residue (e.g. only the CA atoms)");
+        residue.chain = chain;
+        residues.push_back(residue);
+    }
+    return residues;
+}
+
+/**
+ * Parse a domain given as [chain:]first-last.
+ */
+inline Domain parseDomain(const std::string& spec) {
+    Domain domain;
+    std::string range = spec;
+    domain.chainId = 0;
+    if (spec.size() > 2 && spec[1] == ':') {
+        domain.chainId = spec[0];
+        range = spec.substr(2);
+    }
+    size_t dash = range.find('-', 1);
+    auto parseNumber = [&](const std::string& text) {
+        char* end;
+        long value = std::strtol(text.c_str(), &end, 10);
+        if (text.empty() || *end != '\0' || value < INT_MIN || value > INT_MAX)
+            throw OpenMM::OpenMMException("invalid domain "+spec+", expected [chain:]first-last");
+        return (int) value;
+    };
+    if (dash == std::string::npos)
+        throw OpenMM::OpenMMException("invalid domain "+spec+", expected [chain:]first-last");
+    domain.first = parseNumber(range.substr(0, dash));
+    domain.last = parseNumber(range.substr(dash+1));
+    if (domain.first > domain.last)
+        throw OpenMM::OpenMMException("invalid domain "+spec+", the first residue is after the last");
+    return domain;
+}
+
+#endif /*OPENMM_RESIDUEINPUT_H_*/
@@ -0,0 +1,192 @@
+/* -------------------------------------------------------------------------- *
+ *                                   OpenMM                                   *
+ * -------------------------------------------------------------------------- *
+ * This is part of the OpenMM molecular simulation toolkit originating from   *
+ * Simbios, the NIH National Center for Physics-Based Simulation of           *
+ * Biological Structures at Stanford, funded under the NIH Roadmap for        *
+ * Medical Research, grant U54 GM072970. See https://simtk.org.               *
+ *                                                                            *
+ * Portions copyright (c) 2016 Stanford University and the Authors.           *
+ * Authors: Peter Eastman                                                     *
+ * Contributors:                                                              *
+ *                                                                            *
+ * Permission is hereby granted, free of charge, to any person obtaining a    *
+ * copy of this software and associated documentation files (the "Software"), *
+ * to deal in the Software without restriction, including without limitation  *
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,   *
+ * and/or sell copies of the Software, and to permit persons to whom the      *
+ * Software is furnished to do so, subject to the following conditions:       *
+ *                                                                            *
+ * The above copyright notice and this permission notice shall be included in *
+ * all copies or substantial portions of the Software.                        *
+ *                                                                            *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR *
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   *
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    *
+ * THE AUTHORS, CONTRIBUTORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,    *
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR      *
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE  *
+ * USE OR OTHER DEALINGS IN THE SOFTWARE.                                     *
+ * -------------------------------------------------------------------------- */
+
+/**
+ * This tests the cell list search of GenerateExclusions against a direct search over all pairs, and the parsing
+ * of its input.
+ */
+
+#include "DomainPairs.h"
+#include "ResidueInput.h"
+#include "openmm/internal/AssertionUtilities.h"
+#include "sfmt/SFMT.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace OpenMM;
+using namespace std;
+
+/**
+ * Find the pairs by comparing every residue with every other one.
+ */
+vector<pair<int, int> > findPairsDirectly(const vector<Residue>& residues, const vector<int>& domainOfResidue, double cutoff) {
+    vector<pair<int, int> > pairs;
+    for (int i = 0; i < residues.size(); i++)
+        for (int j = i+1; j < residues.size(); j++) {
+            if (domainOfResidue[i] == -1 || domainOfResidue[i] != domainOfResidue[j] || residues[i].chain != residues[j].chain)
+                continue;
+            double dx = residues[j].x-residues[i].x, dy = residues[j].y-residues[i].y, dz = residues[j].z-residues[i].z;
+            if (dx*dx+dy*dy+dz*dz < cutoff*cutoff)
+                pairs.push_back(make_pair(i, j));
+        }
+    return pairs;
+}
+
+void testDomainPairs() {
+    // Three chains of 200 residues in a box that extends to negative coordinates, so cells on both sides of the
+    // origin are used.  Each chain has two domains and a disordered region between them.
+
+    const int numChains = 3, chainLength = 200;
+    const double cutoff = 0.9;
+    OpenMM_SFMT::SFMT sfmt;
+    init_gen_rand(0, sfmt);
+    vector<Residue> residues;
+    vector<int> domainOfResidue;
+    for (int chain = 0; chain < numChains; chain++)
+        for (int i = 0; i < chainLength; i++) {
+            Residue residue;
+            residue.x = 6*genrand_real2(sfmt)-3;
+            residue.y = 6*genrand_real2(sfmt)-3;
+            residue.z = 6*genrand_real2(sfmt)-3;
+            residue.chain = chain;
+            residue.number = i+1;
+            residue.chainId = 'A'+chain;
+            residues.push_back(residue);
+            domainOfResidue.push_back(i < 80 ? 0 : (i < 120 ? -1 : 1));
+        }
+
+    // The cell list has to find exactly the same pairs, including those between neighboring cells and those whose
+    // distance is just below or above the cutoff.
+
+    residues[0].x = 0.0;
+    residues[1].x = cutoff*(1-1e-9);
+    residues[2].x = cutoff*(1+1e-9);
+    for (int i = 0; i < 3; i++)
+        residues[i].y = residues[i].z = 0.0;
+    vector<pair<int, int> > pairs;
+    findDomainPairs(residues, domainOfResidue, cutoff, pairs);
+    sort(pairs.begin(), pairs.end());
+    vector<pair<int, int> > expected = findPairsDirectly(residues, domainOfResidue, cutoff);
+    ASSERT(expected.size() > 100);
+    ASSERT(find(expected.begin(), expected.end(), make_pair(0, 1)) != expected.end());
+    ASSERT(find(expected.begin(), expected.end(), make_pair(0, 2)) == expected.end());
+    ASSERT_EQUAL(expected.size(), pairs.size());
+    for (int i = 0; i < expected.size(); i++) {
+        ASSERT_EQUAL(expected[i].first, pairs[i].first);
+        ASSERT_EQUAL(expected[i].second, pairs[i].second);
+    }
+}
+
+/**
+ * Format an ATOM record.
+ */
+string atomRecord(int serial, const string& name, char chainId, int residue, double x, double y, double z) {
+    char line[81];
+    snprintf(line, sizeof(line), "ATOM  %5d %-4s ALA %c%4d    %8.3f%8.3f%8.3f  1.00  0.00", serial, name.c_str(), chainId, residue, x, y, z);
+    return line;
+}
+
+void testReadPdb() {
+    // A coarse-grained structure with two chains, the second one started by a TER record.
+
+    string path = "residues.pdb";
+    {
+        ofstream pdb(path);
+        pdb << atomRecord(1, "CA", 'A', 1, 0.0, 0.0, 0.0) << endl;
+        pdb << atomRecord(2, "CA", 'A', 2, 3.8, 0.0, 0.0) << endl;
+        pdb << "TER" << endl;
+        pdb << atomRecord(3, "CA", 'A', 1, 0.0, 3.8, 0.0) << endl;
+        pdb << atomRecord(4, "CA", 'B', 1, 0.0, 0.0, 3.8) << endl;
+    }
+    vector<Residue> residues = readPdb(path);
+    ASSERT_EQUAL(4, residues.size());
+    int chains[] = {0, 0, 1, 2};
+    for (int i = 0; i < 4; i++)
+        ASSERT_EQUAL(chains[i], residues[i].chain);
+    ASSERT_EQUAL_TOL(0.38, residues[1].x, 1e-10);
+
+    // An all-atom structure is rejected.
+
+    {
+        ofstream pdb(path);
+        pdb << atomRecord(1, "N", 'A', 1, 0.0, 0.0, 0.0) << endl;
+        pdb << atomRecord(2, "CA", 'A', 1, 1.5, 0.0, 0.0) << endl;
+    }
+    bool threw = false;
+    try {
+        readPdb(path);
+    }
+    catch (const OpenMMException& ex) {
+        threw = true;
+    }
+    ASSERT(threw);
+    remove(path.c_str());
+}
+
+void testParseDomain() {
+    Domain domain = parseDomain("B:10-25");
+    ASSERT_EQUAL('B', domain.chainId);
+    ASSERT_EQUAL(10, domain.first);
+    ASSERT_EQUAL(25, domain.last);
+    domain = parseDomain("-5-3");
+    ASSERT_EQUAL(0, domain.chainId);
+    ASSERT_EQUAL(-5, domain.first);
+    ASSERT_EQUAL(3, domain.last);
+    for (string spec : {"abc-xyz", "1-", "1-2x", "10", "A:1", "5-3", "1-99999999999"}) {
+        bool threw = false;
+        try {
+            parseDomain(spec);
+        }
+        catch (const OpenMMException& ex) {
+            threw = true;
+        }
+        ASSERT(threw);
+    }
+}
+
+int main() {
+    try {
+        testDomainPairs();
+        testReadPdb();
+        testParseDomain();
+    }
+    catch(const exception& e) {
+        cout << "exception: " << e.what() << endl;
+        return 1;
+    }
+    cout << "Done" << endl;
+    return 0;
+}